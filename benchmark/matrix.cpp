@@ -0,0 +1,396 @@
+#include <benchmark/benchmark.h>
+#include <matrix.hpp>
+#include <reduction.hpp>
+#include <structure.hpp>
+#include <vector.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+namespace {
+
+template <class T>
+auto make_square(std::size_t size) -> mtl::DynamicMatrix<T>
+{
+    mtl::DynamicMatrix<T> matrix(size, size);
+    for (std::size_t i = 0; i < size * size; ++i) {
+        matrix.data()[i] = static_cast<T>(i % 17) - static_cast<T>(8);
+    }
+    return matrix;
+}
+
+// Diagonally dominant, so elimination never meets a tiny pivot.
+auto make_regular(std::size_t size) -> mtl::DynamicMatrix<double>
+{
+    auto matrix = make_square<double>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        matrix(i, i) += static_cast<double>(16 * size);
+    }
+    return matrix;
+}
+
+auto set_flops(benchmark::State& state, double flops_per_iteration) -> void
+{
+    state.counters["flops"] = benchmark::Counter(
+        flops_per_iteration,
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <class T>
+auto multiply_dynamic(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto lhs = make_square<T>(size);
+    const auto rhs = make_square<T>(size);
+
+    for (auto _ : state) {
+        auto result = mtl::multiply(lhs, rhs);
+        benchmark::DoNotOptimize(result.data());
+    }
+    set_flops(state, 2.0 * static_cast<double>(size * size * size));
+}
+
+template <class T>
+auto multiply_parallel(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto lhs = make_square<T>(size);
+    const auto rhs = make_square<T>(size);
+
+    for (auto _ : state) {
+        auto result = mtl::multiply(mtl::execution::par, lhs, rhs);
+        benchmark::DoNotOptimize(result.data());
+    }
+    set_flops(state, 2.0 * static_cast<double>(size * size * size));
+}
+
+template <class T>
+auto multiply_into(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto lhs = make_square<T>(size);
+    const auto rhs = make_square<T>(size);
+    mtl::DynamicMatrix<T> result(size, size);
+
+    for (auto _ : state) {
+        mtl::multiply_into(result, lhs, rhs);
+        benchmark::DoNotOptimize(result.data());
+    }
+    set_flops(state, 2.0 * static_cast<double>(size * size * size));
+}
+
+template <class T, std::size_t N>
+auto multiply_fixed(benchmark::State& state) -> void
+{
+    mtl::Matrix<T, N, N> lhs;
+    mtl::Matrix<T, N, N> rhs;
+    for (std::size_t i = 0; i < N * N; ++i) {
+        lhs.data()[i] = static_cast<T>(i % 5);
+        rhs.data()[i] = static_cast<T>(i % 3);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        auto result = lhs * rhs;
+        benchmark::DoNotOptimize(result.data());
+    }
+    set_flops(state, 2.0 * static_cast<double>(N * N * N));
+}
+
+template <class T>
+auto gemv(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+    const mtl::DynamicVector<T> x(size, T{ 1 });
+    mtl::DynamicVector<T> y(size);
+
+    for (auto _ : state) {
+        mtl::gemv(T{ 1 }, matrix, x, T{ 0 }, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+    set_flops(state, 2.0 * static_cast<double>(size * size));
+}
+
+auto determinant(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_regular(size);
+
+    for (auto _ : state) { benchmark::DoNotOptimize(matrix.det()); }
+    set_flops(state, 2.0 / 3.0 * static_cast<double>(size * size * size));
+}
+
+auto triangular_determinant(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto matrix = make_regular(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        for (std::size_t j = i + 1; j < size; ++j) { matrix(i, j) = 0.0; }
+    }
+
+    for (auto _ : state) { benchmark::DoNotOptimize(matrix.det()); }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+template <class T>
+auto multiply_diagonal(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const mtl::DynamicDiagonalMatrix<T> lhs(size, T{ 2 });
+    const auto rhs = make_square<T>(size);
+
+    for (auto _ : state) {
+        auto result = lhs * rhs;
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+template <class T>
+auto transpose(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        auto result = matrix.transpose();
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(
+        state.iterations()
+        * static_cast<std::int64_t>(2 * size * size * sizeof(T)));
+}
+
+template <class T>
+auto transpose_inplace(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        matrix.transpose_inplace();
+        benchmark::DoNotOptimize(matrix.data());
+    }
+    state.SetBytesProcessed(
+        state.iterations()
+        * static_cast<std::int64_t>(2 * size * size * sizeof(T)));
+}
+
+template <class T>
+auto construct(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        mtl::DynamicMatrix<T> matrix(size, size);
+        benchmark::DoNotOptimize(matrix.data());
+    }
+}
+
+template <class T>
+auto copy(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        auto duplicate = matrix;
+        benchmark::DoNotOptimize(duplicate.data());
+    }
+    state.SetBytesProcessed(
+        state.iterations()
+        * static_cast<std::int64_t>(size * size * sizeof(T)));
+}
+
+template <class T>
+auto copy_assign(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+    auto target = make_square<T>(size);
+
+    for (auto _ : state) {
+        target = matrix;
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetBytesProcessed(
+        state.iterations()
+        * static_cast<std::int64_t>(size * size * sizeof(T)));
+}
+
+template <class T>
+auto row_access(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        T sum{};
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto row = matrix[i];
+            for (std::size_t j = 0; j < size; ++j) {
+                sum = static_cast<T>(sum + row[j]);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+template <class T>
+auto element_access(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        T sum{};
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < size; ++j) {
+                sum = static_cast<T>(sum + matrix(i, j));
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+template <class T>
+auto unchecked_access(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        T sum{};
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < size; ++j) {
+                sum = static_cast<T>(sum + matrix.unchecked(i, j));
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+template <class T>
+auto iterate(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        const auto sum = std::reduce(matrix.begin(), matrix.end(), T{});
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+template <class T>
+auto sum(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<T>(size);
+
+    for (auto _ : state) {
+        const auto result = mtl::sum(matrix);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+auto norm_fro(benchmark::State& state) -> void
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto matrix = make_square<double>(size);
+
+    for (auto _ : state) {
+        const auto result = mtl::norm_fro(mtl::execution::par, matrix);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(size * size));
+}
+
+constexpr std::int64_t smallest = 4;
+constexpr std::int64_t largest = 4096;
+constexpr std::int64_t largest_cubic = 1024;
+
+}  // namespace
+
+BENCHMARK(multiply_dynamic<float>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(multiply_dynamic<double>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(multiply_dynamic<std::int32_t>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest_cubic)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(multiply_parallel<double>)
+    ->RangeMultiplier(4)
+    ->Range(64, largest)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(multiply_into<double>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(multiply_fixed<float, 2>);
+BENCHMARK(multiply_fixed<float, 4>);
+BENCHMARK(multiply_fixed<double, 4>);
+BENCHMARK(multiply_fixed<double, 8>);
+
+BENCHMARK(gemv<float>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(gemv<double>)->RangeMultiplier(4)->Range(smallest, largest);
+
+BENCHMARK(determinant)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest_cubic)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(triangular_determinant)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest_cubic)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(multiply_diagonal<double>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(transpose<float>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(transpose<double>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(transpose_inplace<double>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest);
+
+BENCHMARK(construct<double>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(copy<double>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(copy_assign<double>)->RangeMultiplier(4)->Range(smallest, largest);
+
+BENCHMARK(row_access<double>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(element_access<double>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest);
+BENCHMARK(unchecked_access<double>)
+    ->RangeMultiplier(4)
+    ->Range(smallest, largest);
+BENCHMARK(iterate<double>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(sum<double>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(sum<float>)->RangeMultiplier(4)->Range(smallest, largest);
+BENCHMARK(norm_fro)->RangeMultiplier(4)->Range(smallest, largest);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+#ifndef MTL_ASYNC_HPP
+#define MTL_ASYNC_HPP
+
+#include <cstddef>
+#include <future>
+#include <utility>
+
+#include "matrix.hpp"
+
+// Asynchronous products and expression evaluations. Each call queues one task
+// on the pool of its execution policy and returns a std::future, so the
+// caller can keep building the next operands while earlier results are
+// computed.
+namespace mtl {
+
+// Starts multiply(policy, lhs, rhs) and returns a future for the product.
+// The operands are moved or copied into the task, so they may be reused as
+// soon as the call returns. Under execution::seq the product is a single task
+// of default_thread_pool() and independent products run side by side; under
+// a parallel policy it is also split across that pool. Mismatched shapes
+// throw here rather than through the future.
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+    requires detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+auto multiply_async(const P& policy, Matrix<T, I, J> lhs, Matrix<U, A, B> rhs)
+    -> std::future<detail::product_t<T, U, I, J, A, B>>
+{
+    detail::check_multipliable(lhs, rhs);
+
+    return detail::pool_of(policy).async(
+        [policy, lhs = std::move(lhs), rhs = std::move(rhs)] {
+            return multiply(policy, lhs, rhs);
+        });
+}
+
+template <
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+    requires detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+auto multiply_async(Matrix<T, I, J> lhs, Matrix<U, A, B> rhs)
+    -> std::future<detail::product_t<T, U, I, J, A, B>>
+{
+    return multiply_async(execution::seq, std::move(lhs), std::move(rhs));
+}
+
+// Starts evaluating an element-wise expression into a new matrix, in one
+// fused pass as assign() does, and returns a future for the result. The
+// expression is copied into the task but the matrices it reads are not:
+// they must outlive the future and stay unchanged until it is ready.
+template <execution::Policy P, detail::MatrixExpression E>
+auto evaluate_async(const P& policy, const E& expression) -> std::future<
+    Matrix<
+        detail::operand_value_t<E>,
+        detail::operand_traits<E>::rows_extent,
+        detail::operand_traits<E>::cols_extent>>
+{
+    return detail::pool_of(policy).async([policy, expression] {
+        Matrix<
+            detail::operand_value_t<E>,
+            detail::operand_traits<E>::rows_extent,
+            detail::operand_traits<E>::cols_extent>
+            result{ detail::uninitialized,
+                    expression.row_size(),
+                    expression.col_size() };
+        assign(policy, result, expression);
+        return result;
+    });
+}
+
+template <detail::MatrixExpression E>
+auto evaluate_async(const E& expression)
+{
+    return evaluate_async(execution::seq, expression);
+}
+
+}  // namespace mtl
+
+#endif  // MTL_ASYNC_HPP
@@ -0,0 +1,403 @@
+#ifndef MTL_BATCH_HPP
+#define MTL_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "matrix.hpp"
+
+namespace mtl {
+
+// A batch of `size()` independent I x J matrices stored as structure of
+// arrays: the element (row, col) of every matrix lives in one contiguous lane,
+// so the batched operations below run across the batch in their inner loop
+// and vectorize for any I and J.
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+class Batch final {
+    static_assert(I != dynamic and J != dynamic, "Batch: fixed extents only");
+
+   public:
+    using value_type = T;
+    using matrix_type = Matrix<T, I, J>;
+
+    Batch() = default;
+    explicit Batch(std::size_t count, const T& value = T{});
+    Batch(std::size_t count, const Matrix<T, I, J>& matrix);
+
+    [[nodiscard]] static constexpr auto row_size() noexcept -> std::size_t
+    {
+        return I;
+    }
+
+    [[nodiscard]] static constexpr auto col_size() noexcept -> std::size_t
+    {
+        return J;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return count_; }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return count_ == 0; }
+
+    auto resize(std::size_t count) -> void;
+
+    [[nodiscard]] auto data() noexcept -> T* { return elems_.data(); }
+
+    [[nodiscard]] auto data() const noexcept -> const T*
+    {
+        return elems_.data();
+    }
+
+    // The element (row, col) of every matrix in the batch.
+    [[nodiscard]] auto lane(std::size_t row, std::size_t col) -> std::span<T>;
+    [[nodiscard]] auto lane(std::size_t row, std::size_t col) const
+        -> std::span<const T>;
+
+    [[nodiscard]] auto operator()(
+        std::size_t index,
+        std::size_t row,
+        std::size_t col) -> T&;
+    [[nodiscard]] auto operator()(
+        std::size_t index,
+        std::size_t row,
+        std::size_t col) const -> const T&;
+
+    // Gathers matrix `index` out of the lanes, or scatters `matrix` into them.
+    [[nodiscard]] auto get(std::size_t index) const -> Matrix<T, I, J>;
+    auto set(std::size_t index, const Matrix<T, I, J>& matrix) -> void;
+
+    [[nodiscard]] auto transpose() const -> Batch<T, J, I>;
+
+    // Determinant of every matrix in the batch. Unlike Matrix::det the
+    // results are not rounded.
+    [[nodiscard]] auto det() const -> std::vector<double>
+        requires(I == J);
+
+    auto operator+=(const Batch& other) -> Batch&;
+    auto operator-=(const Batch& other) -> Batch&;
+    auto operator*=(T scalar) -> Batch&;
+
+    [[nodiscard]] auto operator==(const Batch& other) const -> bool;
+
+   private:
+    auto check_index(std::size_t index) const -> void
+    {
+        if (index >= count_) {
+            throw std::out_of_range{ "Batch: index out of range" };
+        }
+    }
+
+    auto check_size(const Batch& other) const -> void
+    {
+        if (count_ != other.count_) {
+            throw std::logic_error{ "Batch::invalid size" };
+        }
+    }
+
+    std::size_t count_{ 0 };
+    std::vector<T> elems_;
+};
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+Batch<T, I, J>::Batch(std::size_t count, const T& value)
+    : count_{ count }, elems_(I * J * count, value)
+{
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+Batch<T, I, J>::Batch(std::size_t count, const Matrix<T, I, J>& matrix)
+    : count_{ count }, elems_(I * J * count)
+{
+    for (std::size_t e = 0; e < I * J; ++e) {
+        detail::simd::fill(elems_.data() + e * count, count, matrix.data()[e]);
+    }
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::resize(std::size_t count) -> void
+{
+    if (count == count_) { return; }
+
+    std::vector<T> elems(I * J * count);
+    const auto kept = std::min(count, count_);
+    for (std::size_t e = 0; e < I * J; ++e) {
+        std::copy_n(
+            elems_.data() + e * count_,
+            kept,
+            elems.data() + e * count);
+    }
+    elems_ = std::move(elems);
+    count_ = count;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::lane(std::size_t row, std::size_t col) -> std::span<T>
+{
+    if (row >= I or col >= J) {
+        throw std::out_of_range{ "Batch::lane: index out of range" };
+    }
+    return { elems_.data() + (row * J + col) * count_, count_ };
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::lane(std::size_t row, std::size_t col) const
+    -> std::span<const T>
+{
+    if (row >= I or col >= J) {
+        throw std::out_of_range{ "Batch::lane: index out of range" };
+    }
+    return { elems_.data() + (row * J + col) * count_, count_ };
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::operator()(
+    std::size_t index,
+    std::size_t row,
+    std::size_t col) -> T&
+{
+    check_index(index);
+    return lane(row, col)[index];
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::operator()(
+    std::size_t index,
+    std::size_t row,
+    std::size_t col) const -> const T&
+{
+    check_index(index);
+    return lane(row, col)[index];
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::get(std::size_t index) const -> Matrix<T, I, J>
+{
+    check_index(index);
+
+    Matrix<T, I, J> result;
+    for (std::size_t e = 0; e < I * J; ++e) {
+        result.data()[e] = elems_[e * count_ + index];
+    }
+    return result;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::set(std::size_t index, const Matrix<T, I, J>& matrix)
+    -> void
+{
+    check_index(index);
+
+    for (std::size_t e = 0; e < I * J; ++e) {
+        elems_[e * count_ + index] = matrix.data()[e];
+    }
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::transpose() const -> Batch<T, J, I>
+{
+    Batch<T, J, I> result(count_);
+    for (std::size_t row = 0; row < I; ++row) {
+        for (std::size_t col = 0; col < J; ++col) {
+            std::copy_n(
+                elems_.data() + (row * J + col) * count_,
+                count_,
+                result.data() + (col * I + row) * count_);
+        }
+    }
+    return result;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::det() const -> std::vector<double>
+    requires(I == J)
+{
+    std::vector<double> result(count_);
+    const auto at = [this](std::size_t row, std::size_t col, std::size_t b) {
+        return static_cast<double>(elems_[(row * J + col) * count_ + b]);
+    };
+
+    if constexpr (I <= 4) {
+        for (std::size_t b = 0; b < count_; ++b) {
+            result[b] = detail::small_det<I>(
+                [&at, b](std::size_t row, std::size_t col) {
+                    return at(row, col, b);
+                });
+        }
+    }
+    else {
+        // Pivoting differs from matrix to matrix, so larger determinants are
+        // factored one at a time.
+        std::vector<double> scratch(I * I);
+        for (std::size_t b = 0; b < count_; ++b) {
+            for (std::size_t e = 0; e < I * I; ++e) {
+                scratch[e] = static_cast<double>(elems_[e * count_ + b]);
+            }
+            double determinant = detail::lu_factor(
+                execution::seq,
+                scratch.data(),
+                I,
+                nullptr);
+            for (std::size_t i = 0; i < I; ++i) {
+                determinant *= scratch[i * I + i];
+            }
+            result[b] = determinant;
+        }
+    }
+
+    return result;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::operator+=(const Batch& other) -> Batch&
+{
+    check_size(other);
+    detail::simd::add(elems_.data(), other.elems_.data(), elems_.size());
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::operator-=(const Batch& other) -> Batch&
+{
+    check_size(other);
+    detail::simd::sub(elems_.data(), other.elems_.data(), elems_.size());
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::operator*=(T scalar) -> Batch&
+{
+    detail::simd::scale(elems_.data(), elems_.size(), scalar);
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto Batch<T, I, J>::operator==(const Batch& other) const -> bool
+{
+    return count_ == other.count_
+           and detail::simd::equal(
+               elems_.data(),
+               other.elems_.data(),
+               elems_.size());
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto operator+(Batch<T, I, J> lhs, const Batch<T, I, J>& rhs)
+    -> Batch<T, I, J>
+{
+    lhs += rhs;
+    return lhs;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto operator-(Batch<T, I, J> lhs, const Batch<T, I, J>& rhs)
+    -> Batch<T, I, J>
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto operator*(Batch<T, I, J> lhs, T scalar) -> Batch<T, I, J>
+{
+    lhs *= scalar;
+    return lhs;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto operator*(T scalar, Batch<T, I, J> rhs) -> Batch<T, I, J>
+{
+    rhs *= scalar;
+    return rhs;
+}
+
+namespace detail {
+
+// Lanes [begin, end) of c = a * b. The loops over the matrix elements are
+// fully known at compile time; the innermost loop walks contiguous lanes.
+template <class T, std::size_t I, std::size_t K, std::size_t J>
+auto batch_gemm(
+    const T* a,
+    const T* b,
+    T* c,
+    std::size_t count,
+    std::size_t begin,
+    std::size_t end) noexcept -> void
+{
+    for (std::size_t row = 0; row < I; ++row) {
+        for (std::size_t col = 0; col < J; ++col) {
+            T* out = c + (row * J + col) * count;
+            for (std::size_t lane = begin; lane < end; ++lane) {
+                out[lane] = T{};
+            }
+            for (std::size_t k = 0; k < K; ++k) {
+                const T* lhs = a + (row * K + k) * count;
+                const T* rhs = b + (k * J + col) * count;
+                for (std::size_t lane = begin; lane < end; ++lane) {
+                    out[lane] =
+                        static_cast<T>(out[lane] + lhs[lane] * rhs[lane]);
+                }
+            }
+        }
+    }
+}
+
+// Lanes per task: enough multiply-adds to amortize scheduling.
+template <std::size_t I, std::size_t K, std::size_t J>
+inline constexpr std::size_t batch_grain =
+    std::max<std::size_t>(elementwise_grain / (I * K * J), 64);
+
+}  // namespace detail
+
+// Multiplies matrix i of `lhs` by matrix i of `rhs` for every i.
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t K,
+    std::size_t J>
+auto multiply(
+    const P& policy,
+    const Batch<T, I, K>& lhs,
+    const Batch<T, K, J>& rhs) -> Batch<T, I, J>
+{
+    if (lhs.size() != rhs.size()) {
+        throw std::logic_error{ "Batch::invalid size" };
+    }
+
+    Batch<T, I, J> result(lhs.size());
+    detail::for_each_chunk(
+        policy,
+        lhs.size(),
+        detail::batch_grain<I, K, J>,
+        [&](std::size_t begin, std::size_t end) {
+            detail::batch_gemm<T, I, K, J>(
+                lhs.data(),
+                rhs.data(),
+                result.data(),
+                lhs.size(),
+                begin,
+                end);
+        });
+    return result;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t K, std::size_t J>
+auto multiply(const Batch<T, I, K>& lhs, const Batch<T, K, J>& rhs)
+    -> Batch<T, I, J>
+{
+    return multiply(execution::seq, lhs, rhs);
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t K, std::size_t J>
+auto operator*(const Batch<T, I, K>& lhs, const Batch<T, K, J>& rhs)
+    -> Batch<T, I, J>
+{
+    return multiply(execution::seq, lhs, rhs);
+}
+
+}  // namespace mtl
+
+#endif  // MTL_BATCH_HPP
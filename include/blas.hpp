@@ -0,0 +1,357 @@
+#ifndef MTL_BLAS_HPP
+#define MTL_BLAS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Optional hand-off of large float and double products and factorizations to
+// a BLAS/LAPACK library. Everything below compiles to nothing unless
+// MTL_USE_BLAS is defined, which the MTL_USE_BLAS CMake option does while
+// linking the library it finds. Calls go through the Fortran interface that
+// OpenBLAS, MKL, Accelerate and the reference implementation all export, so
+// no vendor header is needed; define MTL_BLAS_INT as a 64-bit integer type
+// for ILP64 builds.
+#ifndef MTL_BLAS_MIN_SIZE
+#define MTL_BLAS_MIN_SIZE 64
+#endif
+
+namespace mtl::detail::blas {
+
+#if defined(MTL_USE_BLAS)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+#if defined(MTL_BLAS_INT)
+using integer = MTL_BLAS_INT;
+#else
+using integer = int;
+#endif
+
+// Products with fewer multiply-adds than a min_size cube (or square, for
+// matrix-vector products) and factorizations of matrices smaller than
+// min_size stay in the header-only kernels, where the call overhead of the
+// library dominates.
+inline constexpr std::size_t min_size = MTL_BLAS_MIN_SIZE;
+
+template <class T>
+concept Supported =
+    enabled and (std::is_same_v<T, float> or std::is_same_v<T, double>);
+
+#if defined(MTL_USE_BLAS)
+extern "C" {
+auto sgemm_(
+    const char* transa,
+    const char* transb,
+    const integer* m,
+    const integer* n,
+    const integer* k,
+    const float* alpha,
+    const float* a,
+    const integer* lda,
+    const float* b,
+    const integer* ldb,
+    const float* beta,
+    float* c,
+    const integer* ldc) -> void;
+
+auto dgemm_(
+    const char* transa,
+    const char* transb,
+    const integer* m,
+    const integer* n,
+    const integer* k,
+    const double* alpha,
+    const double* a,
+    const integer* lda,
+    const double* b,
+    const integer* ldb,
+    const double* beta,
+    double* c,
+    const integer* ldc) -> void;
+
+auto sgemv_(
+    const char* trans,
+    const integer* m,
+    const integer* n,
+    const float* alpha,
+    const float* a,
+    const integer* lda,
+    const float* x,
+    const integer* incx,
+    const float* beta,
+    float* y,
+    const integer* incy) -> void;
+
+auto dgemv_(
+    const char* trans,
+    const integer* m,
+    const integer* n,
+    const double* alpha,
+    const double* a,
+    const integer* lda,
+    const double* x,
+    const integer* incx,
+    const double* beta,
+    double* y,
+    const integer* incy) -> void;
+
+auto sgetrf_(
+    const integer* m,
+    const integer* n,
+    float* a,
+    const integer* lda,
+    integer* ipiv,
+    integer* info) -> void;
+
+auto dgetrf_(
+    const integer* m,
+    const integer* n,
+    double* a,
+    const integer* lda,
+    integer* ipiv,
+    integer* info) -> void;
+
+auto spotrf_(
+    const char* uplo,
+    const integer* n,
+    float* a,
+    const integer* lda,
+    integer* info) -> void;
+
+auto dpotrf_(
+    const char* uplo,
+    const integer* n,
+    double* a,
+    const integer* lda,
+    integer* info) -> void;
+}
+
+// A row-major operand with strides (rs, cs) is, to a column-major library,
+// its transpose stored with leading dimension rs, or itself stored with
+// leading dimension cs. Other layouts cannot be passed.
+inline auto layout(
+    std::size_t rows,
+    std::size_t cols,
+    std::size_t rs,
+    std::size_t cs,
+    char& trans,
+    integer& ld) noexcept -> bool
+{
+    if (cs == 1 and rs >= std::max<std::size_t>(cols, 1)) {
+        trans = 'N';
+        ld = static_cast<integer>(rs);
+        return true;
+    }
+    if (rs == 1 and cs >= std::max<std::size_t>(rows, 1)) {
+        trans = 'T';
+        ld = static_cast<integer>(cs);
+        return true;
+    }
+    return false;
+}
+
+template <class... Sizes>
+inline auto representable(Sizes... sizes) noexcept -> bool
+{
+    constexpr auto largest =
+        static_cast<std::size_t>(std::numeric_limits<integer>::max());
+    return ((sizes <= largest) and ...);
+}
+
+// Row-major c = alpha * a * b + beta * c, computed as the column-major
+// product c^T = b^T a^T. Returns false, without touching c, when the product
+// is small or an operand has no unit stride.
+template <Supported T>
+auto gemm(
+    std::size_t m,
+    std::size_t n,
+    std::size_t k,
+    T alpha,
+    const T* a,
+    std::size_t rsa,
+    std::size_t csa,
+    const T* b,
+    std::size_t rsb,
+    std::size_t csb,
+    T beta,
+    T* c,
+    std::size_t rsc) -> bool
+{
+    if (m * n * k < min_size * min_size * min_size) { return false; }
+
+    char transa{};
+    char transb{};
+    integer lda{};
+    integer ldb{};
+    if (not representable(m, n, k, rsa, csa, rsb, csb, rsc)
+        or not layout(m, k, rsa, csa, transa, lda)
+        or not layout(k, n, rsb, csb, transb, ldb)) {
+        return false;
+    }
+
+    const auto rows = static_cast<integer>(n);
+    const auto cols = static_cast<integer>(m);
+    const auto depth = static_cast<integer>(k);
+    const auto ldc = static_cast<integer>(rsc);
+    if constexpr (std::is_same_v<T, float>) {
+        sgemm_(
+            &transb,
+            &transa,
+            &rows,
+            &cols,
+            &depth,
+            &alpha,
+            b,
+            &ldb,
+            a,
+            &lda,
+            &beta,
+            c,
+            &ldc);
+    }
+    else {
+        dgemm_(
+            &transb,
+            &transa,
+            &rows,
+            &cols,
+            &depth,
+            &alpha,
+            b,
+            &ldb,
+            a,
+            &lda,
+            &beta,
+            c,
+            &ldc);
+    }
+    return true;
+}
+
+// Row-major y = alpha * a * x + beta * y with contiguous x and y.
+template <Supported T>
+auto gemv(
+    std::size_t m,
+    std::size_t n,
+    T alpha,
+    const T* a,
+    std::size_t rsa,
+    std::size_t csa,
+    const T* x,
+    T beta,
+    T* y) -> bool
+{
+    if (m * n < min_size * min_size) { return false; }
+
+    char trans{};
+    integer lda{};
+    if (not representable(m, n, rsa, csa)
+        or not layout(m, n, rsa, csa, trans, lda)) {
+        return false;
+    }
+
+    // 'N' means the library sees a^T, so the roles of m and n swap.
+    trans = trans == 'N' ? 'T' : 'N';
+    const auto rows = static_cast<integer>(trans == 'T' ? n : m);
+    const auto cols = static_cast<integer>(trans == 'T' ? m : n);
+    const integer unit = 1;
+    if constexpr (std::is_same_v<T, float>) {
+        sgemv_(
+            &trans,
+            &rows,
+            &cols,
+            &alpha,
+            a,
+            &lda,
+            x,
+            &unit,
+            &beta,
+            y,
+            &unit);
+    }
+    else {
+        dgemv_(
+            &trans,
+            &rows,
+            &cols,
+            &alpha,
+            a,
+            &lda,
+            x,
+            &unit,
+            &beta,
+            y,
+            &unit);
+    }
+    return true;
+}
+
+template <class T>
+inline auto transpose_square(T* a, std::size_t n) noexcept -> void
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        for (auto j = i + 1; j < n; ++j) {
+            std::swap(a[i * n + j], a[j * n + i]);
+        }
+    }
+}
+
+// LU factorization with partial pivoting of the row-major n x n matrix `a`,
+// with the layout and pivots of detail::lu_factor(). The matrix is
+// transposed around the column-major factorization, which costs O(n^2) next
+// to its O(n^3). Returns the sign of the row permutation.
+template <Supported T>
+auto lu_factor(T* a, std::size_t n, std::size_t* pivots) -> int
+{
+    const auto size = static_cast<integer>(n);
+    std::vector<integer> swaps(n);
+    integer info{};
+
+    transpose_square(a, n);
+    if constexpr (std::is_same_v<T, float>) {
+        sgetrf_(&size, &size, a, &size, swaps.data(), &info);
+    }
+    else {
+        dgetrf_(&size, &size, a, &size, swaps.data(), &info);
+    }
+    transpose_square(a, n);
+
+    int sign = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto pivot = static_cast<std::size_t>(swaps[i] - 1);
+        if (pivots != nullptr) { pivots[i] = pivot; }
+        if (pivot != i) { sign = -sign; }
+    }
+    return sign;
+}
+
+// Cholesky factorization of the row-major n x n matrix `a`, reading its
+// lower triangle and overwriting it with L. The lower triangle of a
+// row-major matrix is the upper triangle of the same memory read
+// column-major, and U^T U = A there gives L = U^T here. Returns false when
+// the matrix is not positive definite.
+template <Supported T>
+auto cholesky_factor(T* a, std::size_t n) -> bool
+{
+    const auto size = static_cast<integer>(n);
+    const char upper = 'U';
+    integer info{};
+    if constexpr (std::is_same_v<T, float>) {
+        spotrf_(&upper, &size, a, &size, &info);
+    }
+    else {
+        dpotrf_(&upper, &size, a, &size, &info);
+    }
+    return info == 0;
+}
+#endif
+
+}  // namespace mtl::detail::blas
+
+#endif  // MTL_BLAS_HPP
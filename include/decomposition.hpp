@@ -0,0 +1,547 @@
+#ifndef MTL_DECOMPOSITION_HPP
+#define MTL_DECOMPOSITION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matrix.hpp"
+
+namespace mtl {
+
+namespace detail {
+
+template <class T>
+using floating_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+// Matrix of the requested run-time shape, whatever the kind of its extents.
+template <class T, std::size_t I, std::size_t J>
+auto make_matrix(std::size_t rows, std::size_t cols) -> Matrix<T, I, J>
+{
+    if constexpr (Matrix<T, I, J>::is_dynamic) {
+        return Matrix<T, I, J>(rows, cols);
+    }
+    else {
+        Matrix<T, I, J> matrix(T{});
+        if constexpr (not Matrix<T, I, J>::has_inline_storage) {
+            if (rows != I or cols != J) { matrix.realloc(rows, cols); }
+        }
+        return matrix;
+    }
+}
+
+template <
+    class T,
+    std::size_t I,
+    std::size_t J,
+    class U,
+    std::size_t A,
+    std::size_t B>
+auto convert_matrix(const Matrix<U, A, B>& source) -> Matrix<T, I, J>
+{
+    auto matrix = make_matrix<T, I, J>(source.row_size(), source.col_size());
+    std::transform(
+        source.data(),
+        source.data() + source.row_size() * source.col_size(),
+        matrix.data(),
+        [](const U& elem) { return static_cast<T>(elem); });
+    return matrix;
+}
+
+template <class T, std::size_t N>
+auto identity_matrix(std::size_t size) -> Matrix<T, N, N>
+{
+    auto matrix = make_matrix<T, N, N>(size, size);
+    for (std::size_t i = 0; i < size; ++i) {
+        matrix.data()[i * size + i] = T{ 1 };
+    }
+    return matrix;
+}
+
+// x[row, :] -= factor * x[other, :] over the k right-hand sides of x.
+template <class T>
+auto eliminate_row(
+    T* x,
+    std::size_t k,
+    std::size_t row,
+    std::size_t other,
+    T factor) noexcept
+{
+    auto* dst = x + row * k;
+    const auto* src = x + other * k;
+    for (std::size_t j = 0; j < k; ++j) { dst[j] -= factor * src[j]; }
+}
+
+template <class T>
+auto scale_row(T* x, std::size_t k, std::size_t row, T factor) noexcept
+{
+    std::for_each(x + row * k, x + (row + 1) * k, [factor](T& elem) {
+        elem *= factor;
+    });
+}
+
+}  // namespace detail
+
+// LU factorization with partial pivoting, PA = LU, of a square matrix. The
+// matrix is factored once on construction; det(), solve() and inverse() then
+// only cost the triangular solves.
+template <detail::Arithmetic T, std::size_t N>
+class LU final {
+    static_assert(std::is_floating_point_v<T>, "LU: T must be floating point");
+
+   public:
+    using value_type = T;
+
+    template <detail::Arithmetic U>
+    explicit LU(const Matrix<U, N, N>& matrix) : LU(execution::seq, matrix)
+    {
+    }
+
+    template <execution::Policy P, detail::Arithmetic U>
+    LU(const P& policy, const Matrix<U, N, N>& matrix)
+        : factors_{ detail::convert_matrix<T, N, N>(matrix) },
+          pivots_(matrix.row_size())
+    {
+        if (matrix.row_size() != matrix.col_size()) {
+            throw std::logic_error{ "Matrix::LU: invalid size" };
+        }
+
+        sign_ = detail::lu_factor(
+            policy,
+            factors_.data(),
+            size(),
+            pivots_.data());
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return factors_.row_size();
+    }
+
+    // Strict lower triangle: multipliers of the unit lower factor L; upper
+    // triangle: U.
+    [[nodiscard]] auto factors() const noexcept -> const Matrix<T, N, N>&
+    {
+        return factors_;
+    }
+
+    [[nodiscard]] auto pivots() const noexcept
+        -> const std::vector<std::size_t>&
+    {
+        return pivots_;
+    }
+
+    [[nodiscard]] auto is_singular() const noexcept -> bool
+    {
+        for (std::size_t i = 0; i < size(); ++i) {
+            if (factors_.data()[i * size() + i] == T{}) { return true; }
+        }
+        return false;
+    }
+
+    [[nodiscard]] auto det() const noexcept -> T
+    {
+        auto determinant = static_cast<T>(sign_);
+        for (std::size_t i = 0; i < size(); ++i) {
+            determinant *= factors_.data()[i * size() + i];
+        }
+        return determinant;
+    }
+
+    // Solves A X = B for every column of B at once.
+    template <detail::Arithmetic U, std::size_t A, std::size_t K>
+        requires detail::extents_match_v<N, A>
+    [[nodiscard]] auto solve(const Matrix<U, A, K>& rhs) const
+        -> Matrix<
+            T,
+            detail::combined_extent_v<A, N, K>,
+            detail::combined_extent_v<K, N, A>>
+    {
+        if (rhs.row_size() != size()) {
+            throw std::logic_error{ "Matrix::LU: invalid size" };
+        }
+        if (is_singular()) {
+            throw std::domain_error{ "Matrix::LU: singular matrix" };
+        }
+
+        auto solution = detail::convert_matrix<
+            T,
+            detail::combined_extent_v<A, N, K>,
+            detail::combined_extent_v<K, N, A>>(rhs);
+
+        const auto n = size();
+        const auto k = rhs.col_size();
+        const auto* lu = factors_.data();
+        auto* x = solution.data();
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (pivots_[i] != i) {
+                std::swap_ranges(
+                    x + i * k,
+                    x + (i + 1) * k,
+                    x + pivots_[i] * k);
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t p = 0; p < i; ++p) {
+                detail::eliminate_row(x, k, i, p, lu[i * n + p]);
+            }
+        }
+
+        for (std::size_t i = n; i-- > 0;) {
+            for (std::size_t p = i + 1; p < n; ++p) {
+                detail::eliminate_row(x, k, i, p, lu[i * n + p]);
+            }
+            detail::scale_row(x, k, i, T{ 1 } / lu[i * n + i]);
+        }
+
+        return solution;
+    }
+
+    [[nodiscard]] auto inverse() const -> Matrix<T, N, N>
+    {
+        return solve(detail::identity_matrix<T, N>(size()));
+    }
+
+   private:
+    Matrix<T, N, N> factors_;
+    std::vector<std::size_t> pivots_;
+    int sign_{ 1 };
+};
+
+template <detail::Arithmetic U, std::size_t N>
+LU(const Matrix<U, N, N>&) -> LU<detail::floating_t<U>, N>;
+
+template <execution::Policy P, detail::Arithmetic U, std::size_t N>
+LU(const P&, const Matrix<U, N, N>&) -> LU<detail::floating_t<U>, N>;
+
+// Cholesky factorization A = L L^T of a symmetric positive definite matrix.
+// Only the lower triangle of A is read.
+template <detail::Arithmetic T, std::size_t N>
+class Cholesky final {
+    static_assert(
+        std::is_floating_point_v<T>,
+        "Cholesky: T must be floating point");
+
+   public:
+    using value_type = T;
+
+    template <detail::Arithmetic U>
+    explicit Cholesky(const Matrix<U, N, N>& matrix)
+        : lower_{ detail::convert_matrix<T, N, N>(matrix) }
+    {
+        if (matrix.row_size() != matrix.col_size()) {
+            throw std::logic_error{ "Matrix::Cholesky: invalid size" };
+        }
+
+        const auto n = size();
+        auto* l = lower_.data();
+#if defined(MTL_USE_BLAS)
+        if constexpr (detail::blas::Supported<T>) {
+            if (n >= detail::blas::min_size) {
+                if (not detail::blas::cholesky_factor(l, n)) {
+                    throw std::domain_error{
+                        "Matrix::Cholesky: matrix is not positive definite"
+                    };
+                }
+                for (std::size_t j = 0; j < n; ++j) {
+                    std::fill(l + j * n + j + 1, l + (j + 1) * n, T{});
+                }
+                return;
+            }
+        }
+#endif
+        for (std::size_t j = 0; j < n; ++j) {
+            auto* row_j = l + j * n;
+            const auto diagonal =
+                row_j[j] - std::inner_product(row_j, row_j + j, row_j, T{});
+            if (not(diagonal > T{})) {
+                throw std::domain_error{
+                    "Matrix::Cholesky: matrix is not positive definite"
+                };
+            }
+            row_j[j] = std::sqrt(diagonal);
+
+            for (std::size_t i = j + 1; i < n; ++i) {
+                auto* row_i = l + i * n;
+                const auto dot =
+                    std::inner_product(row_i, row_i + j, row_j, T{});
+                row_i[j] = (row_i[j] - dot) / row_j[j];
+            }
+
+            std::fill(row_j + j + 1, row_j + n, T{});
+        }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return lower_.row_size();
+    }
+
+    [[nodiscard]] auto lower() const noexcept -> const Matrix<T, N, N>&
+    {
+        return lower_;
+    }
+
+    [[nodiscard]] auto det() const noexcept -> T
+    {
+        T determinant{ 1 };
+        for (std::size_t i = 0; i < size(); ++i) {
+            determinant *= lower_.data()[i * size() + i];
+        }
+        return determinant * determinant;
+    }
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t K>
+        requires detail::extents_match_v<N, A>
+    [[nodiscard]] auto solve(const Matrix<U, A, K>& rhs) const
+        -> Matrix<
+            T,
+            detail::combined_extent_v<A, N, K>,
+            detail::combined_extent_v<K, N, A>>
+    {
+        if (rhs.row_size() != size()) {
+            throw std::logic_error{ "Matrix::Cholesky: invalid size" };
+        }
+
+        auto solution = detail::convert_matrix<
+            T,
+            detail::combined_extent_v<A, N, K>,
+            detail::combined_extent_v<K, N, A>>(rhs);
+
+        const auto n = size();
+        const auto k = rhs.col_size();
+        const auto* l = lower_.data();
+        auto* x = solution.data();
+
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t p = 0; p < i; ++p) {
+                detail::eliminate_row(x, k, i, p, l[i * n + p]);
+            }
+            detail::scale_row(x, k, i, T{ 1 } / l[i * n + i]);
+        }
+
+        for (std::size_t i = n; i-- > 0;) {
+            for (std::size_t p = i + 1; p < n; ++p) {
+                detail::eliminate_row(x, k, i, p, l[p * n + i]);
+            }
+            detail::scale_row(x, k, i, T{ 1 } / l[i * n + i]);
+        }
+
+        return solution;
+    }
+
+    [[nodiscard]] auto inverse() const -> Matrix<T, N, N>
+    {
+        return solve(detail::identity_matrix<T, N>(size()));
+    }
+
+   private:
+    Matrix<T, N, N> lower_;
+};
+
+template <detail::Arithmetic U, std::size_t N>
+Cholesky(const Matrix<U, N, N>&) -> Cholesky<detail::floating_t<U>, N>;
+
+// Householder QR factorization A = QR of an M x N matrix with M >= N. solve()
+// returns the least-squares solution when the system is overdetermined.
+template <detail::Arithmetic T, std::size_t M, std::size_t N>
+class QR final {
+    static_assert(std::is_floating_point_v<T>, "QR: T must be floating point");
+
+   public:
+    using value_type = T;
+
+    template <detail::Arithmetic U>
+    explicit QR(const Matrix<U, M, N>& matrix)
+        : factors_{ detail::convert_matrix<T, M, N>(matrix) },
+          tau_(matrix.col_size())
+    {
+        if (matrix.row_size() < matrix.col_size()) {
+            throw std::logic_error{ "Matrix::QR: invalid size" };
+        }
+
+        const auto m = rows();
+        const auto n = cols();
+        auto* a = factors_.data();
+        std::vector<T> w(n);
+
+        for (std::size_t k = 0; k < n; ++k) {
+            T norm{};
+            for (std::size_t i = k; i < m; ++i) {
+                norm += a[i * n + k] * a[i * n + k];
+            }
+            norm = std::sqrt(norm);
+            if (norm == T{}) { continue; }
+
+            const auto head = a[k * n + k];
+            const auto beta = head > T{} ? -norm : norm;
+            tau_[k] = (beta - head) / beta;
+
+            const auto scale = T{ 1 } / (head - beta);
+            for (std::size_t i = k + 1; i < m; ++i) { a[i * n + k] *= scale; }
+            a[k * n + k] = beta;
+
+            // A[k:, k+1:] -= tau v (v^T A[k:, k+1:]), with v[0] = 1.
+            std::copy(a + k * n + k + 1, a + (k + 1) * n, w.begin() + k + 1);
+            for (std::size_t i = k + 1; i < m; ++i) {
+                for (std::size_t j = k + 1; j < n; ++j) {
+                    w[j] += a[i * n + k] * a[i * n + j];
+                }
+            }
+            for (std::size_t j = k + 1; j < n; ++j) {
+                a[k * n + j] -= tau_[k] * w[j];
+            }
+            for (std::size_t i = k + 1; i < m; ++i) {
+                const auto factor = tau_[k] * a[i * n + k];
+                for (std::size_t j = k + 1; j < n; ++j) {
+                    a[i * n + j] -= factor * w[j];
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] auto rows() const noexcept -> std::size_t
+    {
+        return factors_.row_size();
+    }
+
+    [[nodiscard]] auto cols() const noexcept -> std::size_t
+    {
+        return factors_.col_size();
+    }
+
+    // Upper triangle: R; strict lower triangle: the Householder vectors.
+    [[nodiscard]] auto factors() const noexcept -> const Matrix<T, M, N>&
+    {
+        return factors_;
+    }
+
+    [[nodiscard]] auto r() const -> Matrix<T, N, N>
+    {
+        auto result = detail::make_matrix<T, N, N>(cols(), cols());
+        for (std::size_t i = 0; i < cols(); ++i) {
+            std::copy(
+                factors_.data() + i * cols() + i,
+                factors_.data() + (i + 1) * cols(),
+                result.data() + i * cols() + i);
+        }
+        return result;
+    }
+
+    // The first N columns of Q.
+    [[nodiscard]] auto q() const -> Matrix<T, M, N>
+    {
+        auto result = detail::make_matrix<T, M, N>(rows(), cols());
+        for (std::size_t i = 0; i < cols(); ++i) {
+            result.data()[i * cols() + i] = T{ 1 };
+        }
+        for (std::size_t k = cols(); k-- > 0;) {
+            apply_reflection(k, result.data(), cols());
+        }
+        return result;
+    }
+
+    [[nodiscard]] auto det() const -> T
+    {
+        if (rows() != cols()) {
+            throw std::logic_error{ "Matrix::QR::det: invalid size" };
+        }
+
+        T determinant{ 1 };
+        for (std::size_t i = 0; i < cols(); ++i) {
+            determinant *= factors_.data()[i * cols() + i];
+            if (tau_[i] != T{}) { determinant = -determinant; }
+        }
+        return determinant;
+    }
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t K>
+        requires detail::extents_match_v<M, A>
+    [[nodiscard]] auto solve(const Matrix<U, A, K>& rhs) const
+        -> Matrix<
+            T,
+            detail::combined_extent_v<N, M, A, K>,
+            detail::combined_extent_v<K, M, N, A>>
+    {
+        if (rhs.row_size() != rows()) {
+            throw std::logic_error{ "Matrix::QR: invalid size" };
+        }
+
+        const auto n = cols();
+        const auto k = rhs.col_size();
+        const auto* a = factors_.data();
+
+        auto projected = detail::convert_matrix<T, dynamic, dynamic>(rhs);
+        auto* y = projected.data();
+        for (std::size_t p = 0; p < n; ++p) { apply_reflection(p, y, k); }
+
+        auto solution = detail::make_matrix<
+            T,
+            detail::combined_extent_v<N, M, A, K>,
+            detail::combined_extent_v<K, M, N, A>>(n, k);
+        auto* x = solution.data();
+        std::copy(y, y + n * k, x);
+
+        for (std::size_t i = n; i-- > 0;) {
+            if (a[i * n + i] == T{}) {
+                throw std::domain_error{ "Matrix::QR: rank deficient matrix" };
+            }
+            for (std::size_t p = i + 1; p < n; ++p) {
+                detail::eliminate_row(x, k, i, p, a[i * n + p]);
+            }
+            detail::scale_row(x, k, i, T{ 1 } / a[i * n + i]);
+        }
+
+        return solution;
+    }
+
+    [[nodiscard]] auto inverse() const -> Matrix<T, N, N>
+    {
+        if (rows() != cols()) {
+            throw std::logic_error{ "Matrix::QR::inverse: invalid size" };
+        }
+        return solve(detail::identity_matrix<T, N>(cols()));
+    }
+
+   private:
+    // Applies H_k = I - tau_k v_k v_k^T to the rows() x k row-major block x.
+    auto apply_reflection(std::size_t k, T* x, std::size_t width) const
+    {
+        if (tau_[k] == T{}) { return; }
+
+        const auto n = cols();
+        const auto* a = factors_.data();
+        std::vector<T> w(x + k * width, x + (k + 1) * width);
+        for (std::size_t i = k + 1; i < rows(); ++i) {
+            for (std::size_t j = 0; j < width; ++j) {
+                w[j] += a[i * n + k] * x[i * width + j];
+            }
+        }
+        for (std::size_t j = 0; j < width; ++j) {
+            x[k * width + j] -= tau_[k] * w[j];
+        }
+        for (std::size_t i = k + 1; i < rows(); ++i) {
+            const auto factor = tau_[k] * a[i * n + k];
+            for (std::size_t j = 0; j < width; ++j) {
+                x[i * width + j] -= factor * w[j];
+            }
+        }
+    }
+
+    Matrix<T, M, N> factors_;
+    std::vector<T> tau_;
+};
+
+template <detail::Arithmetic U, std::size_t M, std::size_t N>
+QR(const Matrix<U, M, N>&) -> QR<detail::floating_t<U>, M, N>;
+
+}  // namespace mtl
+
+#endif  // MTL_DECOMPOSITION_HPP
@@ -0,0 +1,231 @@
+#ifndef MTL_INSTRUMENTATION_HPP
+#define MTL_INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Counters for allocations, temporaries, flops and time spent per operation.
+// Everything below compiles to nothing unless MTL_ENABLE_INSTRUMENTATION is
+// defined; the definition must be the same in every translation unit.
+namespace mtl::instrumentation {
+
+#if defined(MTL_ENABLE_INSTRUMENTATION)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+enum class kind : std::size_t {
+    allocation,
+    deallocation,
+    // A matrix or row copy created on behalf of the caller, such as the
+    // result of a product or an expression evaluated for multiplication.
+    temporary,
+    multiply,
+    det,
+    transpose,
+    assign,
+    reduce,
+};
+
+inline constexpr std::size_t kind_count = 8;
+
+struct event {
+    instrumentation::kind kind;
+    std::size_t bytes{ 0 };
+    std::uint64_t flops{ 0 };
+    std::chrono::nanoseconds elapsed{ 0 };
+};
+
+// Receives every event as it happens, possibly from several threads at once.
+class sink {
+   public:
+    sink() = default;
+    sink(const sink&) = default;
+    sink(sink&&) = default;
+    auto operator=(const sink&) -> sink& = default;
+    auto operator=(sink&&) -> sink& = default;
+    virtual ~sink() = default;
+
+    virtual auto record(const event&) noexcept -> void = 0;
+};
+
+struct statistics {
+    std::uint64_t allocations{ 0 };
+    std::uint64_t deallocations{ 0 };
+    std::uint64_t bytes_allocated{ 0 };
+    std::uint64_t bytes_deallocated{ 0 };
+    std::uint64_t temporaries{ 0 };
+    std::uint64_t flops{ 0 };
+    // Calls and wall time of every operation kind, indexed by kind.
+    std::array<std::uint64_t, kind_count> calls{};
+    std::array<std::chrono::nanoseconds, kind_count> time{};
+};
+
+namespace detail {
+
+struct counters {
+    std::atomic<std::uint64_t> allocations{ 0 };
+    std::atomic<std::uint64_t> deallocations{ 0 };
+    std::atomic<std::uint64_t> bytes_allocated{ 0 };
+    std::atomic<std::uint64_t> bytes_deallocated{ 0 };
+    std::atomic<std::uint64_t> temporaries{ 0 };
+    std::atomic<std::uint64_t> flops{ 0 };
+    std::array<std::atomic<std::uint64_t>, kind_count> calls{};
+    std::array<std::atomic<std::int64_t>, kind_count> time{};
+    std::atomic<instrumentation::sink*> sink{ nullptr };
+};
+
+inline auto global_counters() noexcept -> counters&
+{
+    static counters instance;
+    return instance;
+}
+
+inline auto publish(const event& happened) noexcept -> void
+{
+    if (auto* target = global_counters().sink.load(std::memory_order_acquire);
+        target != nullptr) {
+        target->record(happened);
+    }
+}
+
+inline auto add(
+    std::atomic<std::uint64_t>& counter,
+    std::uint64_t value) noexcept -> void
+{
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+constexpr auto record_allocation([[maybe_unused]] std::size_t bytes) noexcept
+    -> void
+{
+    if constexpr (enabled) {
+        if (std::is_constant_evaluated()) { return; }
+        auto& all = global_counters();
+        add(all.allocations, 1);
+        add(all.bytes_allocated, bytes);
+        publish({ kind::allocation, bytes });
+    }
+}
+
+constexpr auto record_deallocation([[maybe_unused]] std::size_t bytes) noexcept
+    -> void
+{
+    if constexpr (enabled) {
+        if (std::is_constant_evaluated()) { return; }
+        auto& all = global_counters();
+        add(all.deallocations, 1);
+        add(all.bytes_deallocated, bytes);
+        publish({ kind::deallocation, bytes });
+    }
+}
+
+constexpr auto record_temporary([[maybe_unused]] std::size_t bytes) noexcept
+    -> void
+{
+    if constexpr (enabled) {
+        if (std::is_constant_evaluated()) { return; }
+        add(global_counters().temporaries, 1);
+        publish({ kind::temporary, bytes });
+    }
+}
+
+// Times an operation from construction to destruction and records it with
+// the given flop count.
+class scoped_operation {
+   public:
+    constexpr scoped_operation(
+        [[maybe_unused]] instrumentation::kind kind,
+        [[maybe_unused]] std::uint64_t flops = 0) noexcept
+    {
+        if constexpr (enabled) {
+            if (std::is_constant_evaluated()) { return; }
+            kind_ = kind;
+            flops_ = flops;
+            start_ = std::chrono::steady_clock::now();
+            active_ = true;
+        }
+    }
+
+    scoped_operation(const scoped_operation&) = delete;
+    auto operator=(const scoped_operation&) -> scoped_operation& = delete;
+
+    constexpr ~scoped_operation()
+    {
+        if constexpr (enabled) {
+            if (not active_) { return; }
+            const auto elapsed = std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_);
+
+            auto& all = global_counters();
+            const auto index = static_cast<std::size_t>(kind_);
+            add(all.flops, flops_);
+            add(all.calls[index], 1);
+            all.time[index].fetch_add(
+                elapsed.count(),
+                std::memory_order_relaxed);
+            publish({ kind_, 0, flops_, elapsed });
+        }
+    }
+
+   private:
+    instrumentation::kind kind_{ kind::multiply };
+    std::uint64_t flops_{ 0 };
+    std::chrono::steady_clock::time_point start_{};
+    bool active_{ false };
+};
+
+}  // namespace detail
+
+// Installs `target` as the sink of all events, or removes the current sink
+// when null. The sink must outlive its installation.
+inline auto set_sink(sink* target) noexcept -> void
+{
+    detail::global_counters().sink.store(target, std::memory_order_release);
+}
+
+// Totals since start-up or the last reset(); all zero when instrumentation
+// is compiled out.
+[[nodiscard]] inline auto snapshot() noexcept -> statistics
+{
+    auto& all = detail::global_counters();
+    statistics result;
+    result.allocations = all.allocations.load(std::memory_order_relaxed);
+    result.deallocations = all.deallocations.load(std::memory_order_relaxed);
+    result.bytes_allocated =
+        all.bytes_allocated.load(std::memory_order_relaxed);
+    result.bytes_deallocated =
+        all.bytes_deallocated.load(std::memory_order_relaxed);
+    result.temporaries = all.temporaries.load(std::memory_order_relaxed);
+    result.flops = all.flops.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < kind_count; ++i) {
+        result.calls[i] = all.calls[i].load(std::memory_order_relaxed);
+        result.time[i] = std::chrono::nanoseconds{
+            all.time[i].load(std::memory_order_relaxed)
+        };
+    }
+    return result;
+}
+
+inline auto reset() noexcept -> void
+{
+    auto& all = detail::global_counters();
+    all.allocations = 0;
+    all.deallocations = 0;
+    all.bytes_allocated = 0;
+    all.bytes_deallocated = 0;
+    all.temporaries = 0;
+    all.flops = 0;
+    for (auto& calls : all.calls) { calls = 0; }
+    for (auto& time : all.time) { time = 0; }
+}
+
+}  // namespace mtl::instrumentation
+
+#endif  // MTL_INSTRUMENTATION_HPP
@@ -0,0 +1,313 @@
+#ifndef MTL_IO_HPP
+#define MTL_IO_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "matrix.hpp"
+#include "view.hpp"
+
+#if defined(__unix__) or defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MTL_HAS_MMAP
+#endif
+
+// Binary matrix files: a 64 byte header followed by the elements in native
+// byte order, row-major, starting at a 64 byte aligned offset. The elements
+// of a memory-mapped file can therefore be used in place.
+namespace mtl {
+
+enum class dtype : std::uint32_t {
+    int8 = 1,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    int64,
+    uint64,
+    float32,
+    float64,
+    bfloat16,
+    float16,
+};
+
+namespace detail {
+
+template <class T>
+constexpr auto dtype_of() noexcept -> dtype
+{
+    if constexpr (std::is_same_v<T, bfloat16>) { return dtype::bfloat16; }
+#if defined(MTL_HAS_FLOAT16)
+    else if constexpr (std::is_same_v<T, half>) {
+        return dtype::float16;
+    }
+#endif
+    else if constexpr (std::is_floating_point_v<T>) {
+        static_assert(
+            sizeof(T) == 4 or sizeof(T) == 8,
+            "mtl::dtype: unsupported floating point type");
+        return sizeof(T) == 4 ? dtype::float32 : dtype::float64;
+    }
+    else {
+        static_assert(
+            std::is_integral_v<T> and sizeof(T) <= 8,
+            "mtl::dtype: unsupported element type");
+        constexpr std::array<dtype, 4> sign_ed{
+            dtype::int8, dtype::int16, dtype::int32, dtype::int64
+        };
+        constexpr std::array<dtype, 4> unsign_ed{
+            dtype::uint8, dtype::uint16, dtype::uint32, dtype::uint64
+        };
+        constexpr auto index = std::bit_width(sizeof(T)) - 1;
+        return std::is_signed_v<T> ? sign_ed[index] : unsign_ed[index];
+    }
+}
+
+inline constexpr std::array<char, 8> file_magic{ 'M', 'T', 'L', 'M',
+                                                 'A', 'T', 'R', 'X' };
+inline constexpr std::uint32_t file_version = 1;
+inline constexpr std::uint32_t row_major_layout = 0;
+inline constexpr std::size_t file_alignment = 64;
+
+struct file_header {
+    std::array<char, 8> magic{ file_magic };
+    std::uint32_t version{ file_version };
+    std::uint32_t byte_order{ 0x01020304 };
+    dtype type{};
+    std::uint32_t element_size{ 0 };
+    std::uint32_t layout{ row_major_layout };
+    std::uint32_t alignment{ file_alignment };
+    std::uint64_t rows{ 0 };
+    std::uint64_t cols{ 0 };
+    std::uint64_t data_offset{ file_alignment };
+    std::array<std::byte, 8> reserved{};
+};
+
+static_assert(sizeof(file_header) == file_alignment);
+static_assert(std::is_trivially_copyable_v<file_header>);
+
+// Validates `header` for elements of type T and returns the size of the
+// elements in bytes.
+template <class T>
+auto check_header(const file_header& header) -> std::uint64_t
+{
+    if (header.magic != file_magic) {
+        throw std::runtime_error{ "mtl::load: not a matrix file" };
+    }
+    if (header.version != file_version
+        or header.layout != row_major_layout) {
+        throw std::runtime_error{ "mtl::load: unsupported file version" };
+    }
+    if (header.byte_order != file_header{}.byte_order) {
+        throw std::runtime_error{ "mtl::load: foreign byte order" };
+    }
+    if (header.type != dtype_of<T>() or header.element_size != sizeof(T)) {
+        throw std::runtime_error{ "mtl::load: element type mismatch" };
+    }
+    constexpr auto limit = std::numeric_limits<std::uint64_t>::max();
+    if (header.data_offset < sizeof(file_header)
+        or header.data_offset % alignof(T) != 0
+        or (header.cols != 0
+            and header.rows > limit / sizeof(T) / header.cols)) {
+        throw std::runtime_error{ "mtl::load: malformed matrix file" };
+    }
+    return header.rows * header.cols * sizeof(T);
+}
+
+}  // namespace detail
+
+template <detail::Arithmetic T>
+auto save(std::ostream& stream, MatrixView<T> matrix) -> void
+{
+    if (not matrix.is_contiguous()) {
+        const auto elements = matrix.to_matrix();
+        save(stream, MatrixView<T>{ elements });
+        return;
+    }
+
+    detail::file_header header;
+    header.type = detail::dtype_of<T>();
+    header.element_size = sizeof(T);
+    header.rows = matrix.row_size();
+    header.cols = matrix.col_size();
+
+    stream.write(
+        reinterpret_cast<const char*>(&header),
+        static_cast<std::streamsize>(sizeof(header)));
+    stream.write(
+        reinterpret_cast<const char*>(matrix.data()),
+        static_cast<std::streamsize>(matrix.span().size_bytes()));
+
+    if (not stream) { throw std::runtime_error{ "mtl::save: write failed" }; }
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto save(std::ostream& stream, const Matrix<T, I, J>& matrix) -> void
+{
+    save(stream, MatrixView<T>{ matrix });
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+auto save(const std::filesystem::path& path, const Matrix<T, I, J>& matrix)
+    -> void
+{
+    std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+    if (not stream) {
+        throw std::runtime_error{ "mtl::save: cannot open " + path.string() };
+    }
+    save(stream, matrix);
+}
+
+template <detail::Arithmetic T>
+auto load(std::istream& stream) -> DynamicMatrix<T>
+{
+    detail::file_header header;
+    if (not stream.read(
+            reinterpret_cast<char*>(&header),
+            static_cast<std::streamsize>(sizeof(header)))) {
+        throw std::runtime_error{ "mtl::load: truncated matrix file" };
+    }
+    const auto bytes = detail::check_header<T>(header);
+    stream.ignore(
+        static_cast<std::streamsize>(header.data_offset - sizeof(header)));
+
+    DynamicMatrix<T> result{
+        detail::uninitialized,
+        static_cast<std::size_t>(header.rows),
+        static_cast<std::size_t>(header.cols)
+    };
+    if (not stream.read(
+            reinterpret_cast<char*>(result.data()),
+            static_cast<std::streamsize>(bytes))) {
+        throw std::runtime_error{ "mtl::load: truncated matrix file" };
+    }
+    return result;
+}
+
+template <detail::Arithmetic T>
+auto load(const std::filesystem::path& path) -> DynamicMatrix<T>
+{
+    std::ifstream stream{ path, std::ios::binary };
+    if (not stream) {
+        throw std::runtime_error{ "mtl::load: cannot open " + path.string() };
+    }
+    return load<T>(stream);
+}
+
+#if defined(MTL_HAS_MMAP)
+// Read-only mapping of a matrix file. Processes mapping the same file share
+// its page cache copy; nothing is read until the elements are touched.
+template <detail::Arithmetic T>
+class MappedMatrix final {
+   public:
+    explicit MappedMatrix(const std::filesystem::path& path);
+
+    MappedMatrix(const MappedMatrix&) = delete;
+    auto operator=(const MappedMatrix&) -> MappedMatrix& = delete;
+
+    MappedMatrix(MappedMatrix&& other) noexcept
+        : address_{ std::exchange(other.address_, nullptr) },
+          length_{ std::exchange(other.length_, 0) },
+          view_{ std::exchange(other.view_, {}) }
+    {
+    }
+
+    auto operator=(MappedMatrix&& other) noexcept -> MappedMatrix&
+    {
+        if (&other != this) {
+            unmap();
+            address_ = std::exchange(other.address_, nullptr);
+            length_ = std::exchange(other.length_, 0);
+            view_ = std::exchange(other.view_, {});
+        }
+        return *this;
+    }
+
+    ~MappedMatrix() { unmap(); }
+
+    [[nodiscard]] auto view() const noexcept -> MatrixView<T> { return view_; }
+
+   private:
+    auto unmap() noexcept -> void
+    {
+        if (address_ != nullptr) { ::munmap(address_, length_); }
+    }
+
+    void* address_{ nullptr };
+    std::size_t length_{ 0 };
+    MatrixView<T> view_;
+};
+
+template <detail::Arithmetic T>
+MappedMatrix<T>::MappedMatrix(const std::filesystem::path& path)
+{
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error{ "mtl::map: cannot open " + path.string() };
+    }
+
+    struct ::stat status {};
+    if (::fstat(descriptor, &status) != 0
+        or static_cast<std::size_t>(status.st_size)
+               < sizeof(detail::file_header)) {
+        ::close(descriptor);
+        throw std::runtime_error{ "mtl::load: truncated matrix file" };
+    }
+
+    length_ = static_cast<std::size_t>(status.st_size);
+    address_ = ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);
+    if (address_ == MAP_FAILED) {
+        address_ = nullptr;
+        throw std::runtime_error{ "mtl::map: mmap failed" };
+    }
+
+    detail::file_header header;
+    std::memcpy(&header, address_, sizeof(header));
+    try {
+        const auto bytes = detail::check_header<T>(header);
+        if (header.data_offset > length_
+            or bytes > length_ - header.data_offset) {
+            throw std::runtime_error{ "mtl::load: truncated matrix file" };
+        }
+    }
+    catch (...) {
+        unmap();
+        throw;
+    }
+
+    view_ = MatrixView<T>{
+        reinterpret_cast<const T*>(
+            static_cast<const std::byte*>(address_) + header.data_offset),
+        static_cast<std::size_t>(header.rows),
+        static_cast<std::size_t>(header.cols)
+    };
+}
+
+// Maps the matrix file at `path` without copying its elements.
+template <detail::Arithmetic T>
+auto map_file(const std::filesystem::path& path) -> MappedMatrix<T>
+{
+    return MappedMatrix<T>{ path };
+}
+#endif
+
+}  // namespace mtl
+
+#endif  // MTL_IO_HPP
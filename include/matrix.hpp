@@ -10,42 +10,1629 @@
 #ifndef MTL_MATRIX_HPP
 #define MTL_MATRIX_HPP
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <new>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "blas.hpp"
+#include "instrumentation.hpp"
+#include "memory.hpp"
+#include "precision.hpp"
+#include "thread_pool.hpp"
+
+#ifndef MTL_INLINE_STORAGE_THRESHOLD
+#define MTL_INLINE_STORAGE_THRESHOLD 16
+#endif
+
+#if not defined(MTL_DISABLE_SIMD) and (defined(__GNUC__) or defined(__clang__))
+#if defined(__x86_64__) or defined(__i386__)
+#define MTL_SIMD_X86
+#elif defined(__ARM_NEON)
+#define MTL_SIMD_NEON
+#endif
+#endif
+
 namespace mtl {
 
+// Extent of a matrix whose shape is only known at run time.
+inline constexpr std::size_t dynamic = std::numeric_limits<std::size_t>::max();
+
 namespace detail {
 
-template <class At_>
-static inline constexpr auto is_arithmetic_v = std::is_arithmetic<At_>::value;
+template <class At_>
+static inline constexpr auto is_arithmetic_v =
+    std::is_arithmetic<At_>::value or is_low_precision_v<At_>;
+
+template <class At_, class Au_>
+static inline constexpr auto is_same_v = std::is_same<At_, Au_>::value;
+
+template <class At_, class Au_>
+static inline constexpr auto is_convertible_v =
+    std::is_convertible<Au_, Au_>::value;
+
+// clang-format off
+template <typename Ta_>
+concept Arithmetic = is_arithmetic_v<Ta_> and requires(Ta_ a_type) {
+    a_type + a_type;
+    a_type - a_type;
+    a_type * a_type;
+    a_type == a_type;
+    a_type != a_type;
+};
+
+template <class Ta_, class Tb_>
+concept Scalar = std::is_scalar_v<Ta_>
+                 and requires(Ta_ a_type, Tb_ b_type) { a_type * b_type; };
+// clang-format on
+
+// Bounds check of operator() and operator[]. They throw std::out_of_range
+// like at() does, unless MTL_ASSERT_BOUNDS is defined: then they assert,
+// and compile to nothing when NDEBUG is defined too.
+constexpr auto check_index(
+    [[maybe_unused]] bool in_range,
+    [[maybe_unused]] const char* message) -> void
+{
+#if defined(MTL_ASSERT_BOUNDS)
+    assert(in_range and message);
+#else
+    if (not in_range) { throw std::out_of_range{ message }; }
+#endif
+}
+
+static inline constexpr std::size_t storage_alignment = 64;
+
+// Elements are kept row-major in a single aligned block. The row pointer
+// table returned by Matrix::underlying_array() lives at the end of the same
+// block, so a matrix costs one allocation regardless of its row count. The
+// first block comes from current_resource(); later blocks, and every
+// deallocation, use that same resource.
+template <class T>
+struct heap_storage {
+    T* elems{ nullptr };
+    T** rows{ nullptr };
+    std::pmr::memory_resource* resource{ nullptr };
+    std::size_t bytes{ 0 };
+
+    static constexpr auto table_offset(std::size_t count) noexcept
+        -> std::size_t
+    {
+        constexpr auto align = alignof(T*);
+        return (count * sizeof(T) + align - 1) / align * align;
+    }
+
+    constexpr auto data() noexcept -> T* { return elems; }
+    constexpr auto data() const noexcept -> const T* { return elems; }
+
+    constexpr auto allocate(std::size_t row_count, std::size_t col_count)
+    {
+        allocate_block(row_count * col_count, row_count);
+        bind_rows(row_count, col_count);
+    }
+
+    constexpr auto allocate_block(std::size_t count, std::size_t row_count)
+    {
+        if (count == 0) { return; }
+
+        if (resource == nullptr) { resource = current_resource(); }
+        bytes = table_offset(count) + row_count * sizeof(T*);
+        auto* block = static_cast<std::byte*>(
+            resource->allocate(bytes, storage_alignment));
+        instrumentation::detail::record_allocation(bytes);
+
+        elems = reinterpret_cast<T*>(block);
+        rows = reinterpret_cast<T**>(block + table_offset(count));
+    }
+
+    constexpr auto bind_rows(
+        std::size_t row_count,
+        std::size_t col_count) noexcept
+    {
+        if (rows == nullptr) { return; }
+
+        for (std::size_t i = 0; i < row_count; ++i) {
+            rows[i] = elems + i * col_count;
+        }
+    }
+
+    constexpr auto deallocate() noexcept
+    {
+        if (elems != nullptr) {
+            resource->deallocate(elems, bytes, storage_alignment);
+            instrumentation::detail::record_deallocation(bytes);
+        }
+        elems = nullptr;
+        rows = nullptr;
+        bytes = 0;
+    }
+};
+
+// Runtime-sized matrices remember how many elements and rows their block can
+// hold, so that reshaping within that capacity does not allocate.
+template <class T>
+struct dynamic_storage : heap_storage<T> {
+    std::size_t capacity{ 0 };
+    std::size_t row_capacity{ 0 };
+
+    [[nodiscard]] constexpr auto fits(
+        std::size_t count,
+        std::size_t row_count) const noexcept -> bool
+    {
+        return count <= capacity and row_count <= row_capacity;
+    }
+
+    [[nodiscard]] static constexpr auto with_capacity(
+        std::size_t count,
+        std::size_t row_count,
+        std::pmr::memory_resource* resource) -> dynamic_storage
+    {
+        dynamic_storage storage;
+        storage.resource = resource;
+        storage.allocate_block(count, row_count);
+        if (storage.elems != nullptr) {
+            storage.capacity = count;
+            storage.row_capacity = row_count;
+        }
+        return storage;
+    }
+
+    constexpr auto allocate(std::size_t row_count, std::size_t col_count)
+    {
+        if (not fits(row_count * col_count, row_count)) {
+            deallocate();
+            *this = with_capacity(
+                row_count * col_count,
+                row_count,
+                this->resource);
+        }
+        this->bind_rows(row_count, col_count);
+    }
+
+    constexpr auto deallocate() noexcept
+    {
+        heap_storage<T>::deallocate();
+        capacity = 0;
+        row_capacity = 0;
+    }
+};
+
+// Selects the constructor that allocates a matrix without setting its
+// elements, for results that are overwritten in full right away.
+struct uninitialized_t {
+    explicit uninitialized_t() = default;
+};
+
+inline constexpr uninitialized_t uninitialized{};
+
+// Small fixed extents keep their elements inside the object, which makes
+// the matrix trivially copyable and usable in constant expressions.
+template <class T, std::size_t N>
+struct inline_storage {
+    std::array<T, N> elems{};
+
+    constexpr auto data() noexcept -> T* { return elems.data(); }
+    constexpr auto data() const noexcept -> const T* { return elems.data(); }
+};
+
+// An extent is dynamic when it, or any extent it is combined with, is
+// dynamic; a product of a fixed and a runtime-sized matrix is runtime-sized.
+template <std::size_t Extent, std::size_t... Others>
+static inline constexpr std::size_t combined_extent_v =
+    ((Extent == dynamic) or ... or (Others == dynamic)) ? dynamic : Extent;
+
+template <std::size_t I, std::size_t J>
+static inline constexpr bool use_inline_storage_v =
+    I != dynamic and J != dynamic and I * J != 0
+    and I * J <= MTL_INLINE_STORAGE_THRESHOLD;
+
+template <class T, std::size_t I, std::size_t J>
+using storage_t = std::conditional_t<
+    use_inline_storage_v<I, J>,
+    inline_storage<T, I * J>,
+    std::conditional_t<
+        I == dynamic or J == dynamic,
+        dynamic_storage<T>,
+        heap_storage<T>>>;
+
+namespace simd {
+
+enum class isa { scalar, avx2, avx512, neon };
+
+template <class T>
+concept Vectorizable = is_same_v<T, float> or is_same_v<T, double>
+                       or is_same_v<T, std::int32_t>
+                       or is_same_v<T, std::int64_t>;
+
+// Low-precision types whose products are widened to float lane by lane.
+#if defined(MTL_HAS_FLOAT16)
+template <class T>
+concept Widenable = is_same_v<T, bfloat16> or is_same_v<T, half>;
+#else
+template <class T>
+concept Widenable = is_same_v<T, bfloat16>;
+#endif
+
+// Below this many elements the call into a dispatched kernel costs more than
+// the scalar loop, which the compiler vectorizes for the baseline ISA anyway.
+static inline constexpr std::size_t dispatch_threshold = 32;
+
+inline auto detected_isa() noexcept -> isa
+{
+    static const isa level = [] {
+#if defined(MTL_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")
+            and __builtin_cpu_supports("avx512dq")) {
+            return isa::avx512;
+        }
+        if (__builtin_cpu_supports("avx2")) { return isa::avx2; }
+#elif defined(MTL_SIMD_NEON)
+        return isa::neon;
+#endif
+        return isa::scalar;
+    }();
+    return level;
+}
+
+inline auto supports(isa level) noexcept -> bool
+{
+    const auto detected = detected_isa();
+    switch (level) {
+        case isa::scalar: return true;
+        case isa::avx2:
+            return detected == isa::avx2 or detected == isa::avx512;
+        case isa::avx512: return detected == isa::avx512;
+        case isa::neon: return detected == isa::neon;
+    }
+    return false;
+}
+
+enum class op { add, sub };
+
+enum class reduction { sum, sum_squares, sum_abs, min, max };
+
+// Sums are accumulated in the accumulator of the element type, except that
+// integer squares are summed in double, where they cannot overflow; minima
+// and maxima are elements.
+template <reduction R, class T>
+using reduction_t = std::conditional_t<
+    R == reduction::min or R == reduction::max,
+    T,
+    std::conditional_t<
+        R == reduction::sum_squares
+            and not std::is_floating_point_v<accumulator_t<T>>,
+        double,
+        accumulator_t<T>>>;
+
+// Folds one more value, or vector of values, into a partial reduction.
+template <reduction R, class V>
+[[gnu::always_inline]] inline constexpr auto accumulate(
+    V& partial,
+    const V& value) noexcept
+{
+    if constexpr (R == reduction::sum) { partial += value; }
+    else if constexpr (R == reduction::sum_squares) {
+        partial += value * value;
+    }
+    else if constexpr (R == reduction::sum_abs) {
+        partial += value < V{} ? -value : value;
+    }
+    else if constexpr (R == reduction::min) {
+        partial = value < partial ? value : partial;
+    }
+    else {
+        partial = partial < value ? value : partial;
+    }
+}
+
+// Reduces count elements spaced stride apart. Minima and maxima need at
+// least one element.
+template <reduction R, class T>
+constexpr auto reduce_strided(
+    const T* elems,
+    std::size_t count,
+    std::size_t stride) -> reduction_t<R, T>
+{
+    using result_type = reduction_t<R, T>;
+
+    if constexpr (R == reduction::min or R == reduction::max) {
+        auto result = elems[0];
+        for (std::size_t i = 1; i < count; ++i) {
+            const auto value = elems[i * stride];
+            if (R == reduction::min ? value < result : result < value) {
+                result = value;
+            }
+        }
+        return result;
+    }
+    else {
+        result_type result{};
+        for (std::size_t i = 0; i < count; ++i) {
+            auto value = static_cast<result_type>(elems[i * stride]);
+            if constexpr (R == reduction::sum_squares) { value *= value; }
+            if constexpr (R == reduction::sum_abs
+                          and not std::is_unsigned_v<result_type>) {
+                if (value < result_type{}) { value = -value; }
+            }
+            result = static_cast<result_type>(result + value);
+        }
+        return result;
+    }
+}
+
+#if defined(MTL_SIMD_X86) or defined(MTL_SIMD_NEON)
+template <std::size_t Width, class T>
+struct lanes {
+    using type [[gnu::vector_size(Width)]] = T;
+};
+
+template <std::size_t Width, op Op, class T>
+[[gnu::always_inline]] inline auto binary_n(
+    T* dst,
+    const T* src,
+    std::size_t count) noexcept
+{
+    using vec = typename lanes<Width, T>::type;
+    constexpr auto step = Width / sizeof(T);
+
+    std::size_t i = 0;
+    for (; i + step <= count; i += step) {
+        vec lhs;
+        vec rhs;
+        __builtin_memcpy(&lhs, dst + i, sizeof(vec));
+        __builtin_memcpy(&rhs, src + i, sizeof(vec));
+        if constexpr (Op == op::add) { lhs += rhs; }
+        else {
+            lhs -= rhs;
+        }
+        __builtin_memcpy(dst + i, &lhs, sizeof(vec));
+    }
+    for (; i < count; ++i) {
+        if constexpr (Op == op::add) { dst[i] += src[i]; }
+        else {
+            dst[i] -= src[i];
+        }
+    }
+}
+
+template <std::size_t Width, class T>
+[[gnu::always_inline]] inline auto scale_n(
+    T* dst,
+    std::size_t count,
+    T factor) noexcept
+{
+    using vec = typename lanes<Width, T>::type;
+    constexpr auto step = Width / sizeof(T);
+
+    const vec factors = vec{} + factor;
+    std::size_t i = 0;
+    for (; i + step <= count; i += step) {
+        vec values;
+        __builtin_memcpy(&values, dst + i, sizeof(vec));
+        values *= factors;
+        __builtin_memcpy(dst + i, &values, sizeof(vec));
+    }
+    for (; i < count; ++i) { dst[i] *= factor; }
+}
+
+template <std::size_t Width, class T>
+[[gnu::always_inline]] inline auto fill_n(
+    T* dst,
+    std::size_t count,
+    T value) noexcept
+{
+    using vec = typename lanes<Width, T>::type;
+    constexpr auto step = Width / sizeof(T);
+
+    const vec values = vec{} + value;
+    std::size_t i = 0;
+    for (; i + step <= count; i += step) {
+        __builtin_memcpy(dst + i, &values, sizeof(vec));
+    }
+    for (; i < count; ++i) { dst[i] = value; }
+}
+
+template <std::size_t Width, class T>
+[[gnu::always_inline]] inline auto equal_n(
+    const T* lhs,
+    const T* rhs,
+    std::size_t count) noexcept -> bool
+{
+    using vec = typename lanes<Width, T>::type;
+    constexpr auto step = Width / sizeof(T);
+
+    std::size_t i = 0;
+    for (; i + step <= count; i += step) {
+        vec lhs_values;
+        vec rhs_values;
+        __builtin_memcpy(&lhs_values, lhs + i, sizeof(vec));
+        __builtin_memcpy(&rhs_values, rhs + i, sizeof(vec));
+        const auto mismatch = lhs_values != rhs_values;
+        for (std::size_t lane = 0; lane < step; ++lane) {
+            if (mismatch[lane] != 0) { return false; }
+        }
+    }
+    for (; i < count; ++i) {
+        if (lhs[i] != rhs[i]) { return false; }
+    }
+    return true;
+}
+
+// Two independent accumulators hide the latency of the vector adds.
+template <std::size_t Width, class T>
+[[gnu::always_inline]] inline auto dot_n(
+    const T* lhs,
+    const T* rhs,
+    std::size_t count) noexcept -> T
+{
+    using vec = typename lanes<Width, T>::type;
+    constexpr auto step = Width / sizeof(T);
+
+    vec first{};
+    vec second{};
+    std::size_t i = 0;
+    for (; i + 2 * step <= count; i += 2 * step) {
+        vec lhs_low;
+        vec lhs_high;
+        vec rhs_low;
+        vec rhs_high;
+        __builtin_memcpy(&lhs_low, lhs + i, sizeof(vec));
+        __builtin_memcpy(&lhs_high, lhs + i + step, sizeof(vec));
+        __builtin_memcpy(&rhs_low, rhs + i, sizeof(vec));
+        __builtin_memcpy(&rhs_high, rhs + i + step, sizeof(vec));
+        first += lhs_low * rhs_low;
+        second += lhs_high * rhs_high;
+    }
+    first += second;
+
+    T sum{};
+    for (std::size_t lane = 0; lane < step; ++lane) { sum += first[lane]; }
+    for (; i < count; ++i) { sum += lhs[i] * rhs[i]; }
+    return sum;
+}
+
+// Loads Width / sizeof(float) low-precision elements as floats. A bfloat16
+// is the upper half of a float, so widening it is a shift. The result is an
+// out parameter: returning a vector by value would change the ABI.
+template <std::size_t Width, class T>
+[[gnu::always_inline]] inline auto widen(
+    const T* elems,
+    typename lanes<Width, float>::type& wide) noexcept
+{
+    using vec = typename lanes<Width, float>::type;
+    if constexpr (is_same_v<T, bfloat16>) {
+        using narrow = typename lanes<Width / 2, std::uint16_t>::type;
+        using bits = typename lanes<Width, std::uint32_t>::type;
+        narrow loaded;
+        __builtin_memcpy(&loaded, elems, sizeof(narrow));
+        wide = __builtin_bit_cast(
+            vec,
+            __builtin_convertvector(loaded, bits) << 16U);
+    }
+    else {
+        // GCC converts vectors of _Float16 element by element, so the bits
+        // are rebiased instead: exponent and mantissa moved into place and
+        // scaled by 2^112 (which also normalizes subnormals), infinities and
+        // NaNs given an all-ones exponent, and the sign put back.
+        using narrow = typename lanes<Width / 2, std::uint16_t>::type;
+        using bits = typename lanes<Width, std::uint32_t>::type;
+        narrow loaded;
+        __builtin_memcpy(&loaded, elems, sizeof(narrow));
+        const auto halves = __builtin_convertvector(loaded, bits);
+        const auto scaled =
+            __builtin_bit_cast(vec, (halves & 0x7FFFU) << 13U) * 0x1p112F;
+        const auto special =
+            __builtin_bit_cast(bits, scaled >= 65536.0F) & 0x7F80'0000U;
+        wide = __builtin_bit_cast(
+            vec,
+            __builtin_bit_cast(bits, scaled) | special
+                | ((halves & 0x8000U) << 16U));
+    }
+}
+
+template <std::size_t Width, class T>
+[[gnu::always_inline]] inline auto widening_dot_n(
+    const T* lhs,
+    const T* rhs,
+    std::size_t count) noexcept -> float
+{
+    using vec = typename lanes<Width, float>::type;
+    constexpr auto step = Width / sizeof(float);
+
+    vec first{};
+    vec second{};
+    std::size_t i = 0;
+    for (; i + 2 * step <= count; i += 2 * step) {
+        vec lhs_low;
+        vec lhs_high;
+        vec rhs_low;
+        vec rhs_high;
+        widen<Width>(lhs + i, lhs_low);
+        widen<Width>(lhs + i + step, lhs_high);
+        widen<Width>(rhs + i, rhs_low);
+        widen<Width>(rhs + i + step, rhs_high);
+        first += lhs_low * rhs_low;
+        second += lhs_high * rhs_high;
+    }
+    first += second;
+
+    float sum{};
+    for (std::size_t lane = 0; lane < step; ++lane) { sum += first[lane]; }
+    for (; i < count; ++i) {
+        sum += static_cast<float>(lhs[i]) * static_cast<float>(rhs[i]);
+    }
+    return sum;
+}
+
+// Two independent partial reductions, as in dot_n().
+template <std::size_t Width, reduction R, class T>
+[[gnu::always_inline]] inline auto reduce_n(
+    const T* elems,
+    std::size_t count) noexcept -> T
+{
+    using vec = typename lanes<Width, T>::type;
+    constexpr auto step = Width / sizeof(T);
+    constexpr auto extremum = R == reduction::min or R == reduction::max;
+
+    if (count < 2 * step) { return reduce_strided<R>(elems, count, 1); }
+
+    vec first{};
+    vec second{};
+    std::size_t i = 0;
+    if constexpr (extremum) {
+        __builtin_memcpy(&first, elems, sizeof(vec));
+        __builtin_memcpy(&second, elems + step, sizeof(vec));
+        i = 2 * step;
+    }
+    for (; i + 2 * step <= count; i += 2 * step) {
+        vec low;
+        vec high;
+        __builtin_memcpy(&low, elems + i, sizeof(vec));
+        __builtin_memcpy(&high, elems + i + step, sizeof(vec));
+        accumulate<R>(first, low);
+        accumulate<R>(second, high);
+    }
+    if constexpr (extremum) { accumulate<R>(first, second); }
+    else {
+        first += second;
+    }
+
+    T result = first[0];
+    for (std::size_t lane = 1; lane < step; ++lane) {
+        const T value = first[lane];
+        if constexpr (extremum) { accumulate<R>(result, value); }
+        else {
+            result += value;
+        }
+    }
+    for (; i < count; ++i) { accumulate<R>(result, elems[i]); }
+    return result;
+}
+#endif
+
+template <isa Level>
+struct kernels;
+
+#if defined(MTL_SIMD_X86)
+template <>
+struct kernels<isa::avx2> {
+    template <op Op, class T>
+    [[gnu::target("avx2")]] static auto binary(
+        T* dst,
+        const T* src,
+        std::size_t count) noexcept
+    {
+        binary_n<32, Op>(dst, src, count);
+    }
+
+    template <class T>
+    [[gnu::target("avx2")]] static auto scale(
+        T* dst,
+        std::size_t count,
+        T factor) noexcept
+    {
+        scale_n<32>(dst, count, factor);
+    }
+
+    template <class T>
+    [[gnu::target("avx2")]] static auto fill(
+        T* dst,
+        std::size_t count,
+        T value) noexcept
+    {
+        fill_n<32>(dst, count, value);
+    }
+
+    template <class T>
+    [[gnu::target("avx2")]] static auto equal(
+        const T* lhs,
+        const T* rhs,
+        std::size_t count) noexcept -> bool
+    {
+        return equal_n<32>(lhs, rhs, count);
+    }
+
+    template <class T>
+    [[gnu::target("avx2")]] static auto dot(
+        const T* lhs,
+        const T* rhs,
+        std::size_t count) noexcept -> T
+    {
+        return dot_n<32>(lhs, rhs, count);
+    }
+
+    template <class T>
+    [[gnu::target("avx2")]] static auto widening_dot(
+        const T* lhs,
+        const T* rhs,
+        std::size_t count) noexcept -> float
+    {
+        return widening_dot_n<32>(lhs, rhs, count);
+    }
+
+    template <reduction R, class T>
+    [[gnu::target("avx2")]] static auto reduce(
+        const T* elems,
+        std::size_t count) noexcept -> T
+    {
+        return reduce_n<32, R>(elems, count);
+    }
+};
+
+template <>
+struct kernels<isa::avx512> {
+    template <op Op, class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto binary(
+        T* dst,
+        const T* src,
+        std::size_t count) noexcept
+    {
+        binary_n<64, Op>(dst, src, count);
+    }
+
+    template <class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto scale(
+        T* dst,
+        std::size_t count,
+        T factor) noexcept
+    {
+        scale_n<64>(dst, count, factor);
+    }
+
+    template <class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto fill(
+        T* dst,
+        std::size_t count,
+        T value) noexcept
+    {
+        fill_n<64>(dst, count, value);
+    }
+
+    template <class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto equal(
+        const T* lhs,
+        const T* rhs,
+        std::size_t count) noexcept -> bool
+    {
+        return equal_n<64>(lhs, rhs, count);
+    }
+
+    template <class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto dot(
+        const T* lhs,
+        const T* rhs,
+        std::size_t count) noexcept -> T
+    {
+        return dot_n<64>(lhs, rhs, count);
+    }
+
+    template <class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto widening_dot(
+        const T* lhs,
+        const T* rhs,
+        std::size_t count) noexcept -> float
+    {
+        return widening_dot_n<64>(lhs, rhs, count);
+    }
+
+    template <reduction R, class T>
+    [[gnu::target("avx512f,avx512dq")]] static auto reduce(
+        const T* elems,
+        std::size_t count) noexcept -> T
+    {
+        return reduce_n<64, R>(elems, count);
+    }
+};
+#elif defined(MTL_SIMD_NEON)
+template <>
+struct kernels<isa::neon> {
+    template <op Op, class T>
+    static auto binary(T* dst, const T* src, std::size_t count) noexcept
+    {
+        binary_n<16, Op>(dst, src, count);
+    }
+
+    template <class T>
+    static auto scale(T* dst, std::size_t count, T factor) noexcept
+    {
+        scale_n<16>(dst, count, factor);
+    }
+
+    template <class T>
+    static auto fill(T* dst, std::size_t count, T value) noexcept
+    {
+        fill_n<16>(dst, count, value);
+    }
+
+    template <class T>
+    static auto equal(const T* lhs, const T* rhs, std::size_t count) noexcept
+        -> bool
+    {
+        return equal_n<16>(lhs, rhs, count);
+    }
+
+    template <class T>
+    static auto dot(const T* lhs, const T* rhs, std::size_t count) noexcept
+        -> T
+    {
+        return dot_n<16>(lhs, rhs, count);
+    }
+
+    template <reduction R, class T>
+    static auto reduce(const T* elems, std::size_t count) noexcept -> T
+    {
+        return reduce_n<16, R>(elems, count);
+    }
+};
+#endif
+
+template <op Op, class T>
+constexpr auto binary(isa level, T* dst, const T* src, std::size_t count)
+{
+    if constexpr (Vectorizable<T>) {
+        switch (level) {
+#if defined(MTL_SIMD_X86)
+            case isa::avx512:
+                return kernels<isa::avx512>::binary<Op>(dst, src, count);
+            case isa::avx2:
+                return kernels<isa::avx2>::binary<Op>(dst, src, count);
+#elif defined(MTL_SIMD_NEON)
+            case isa::neon:
+                return kernels<isa::neon>::binary<Op>(dst, src, count);
+#endif
+            default: break;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if constexpr (Op == op::add) {
+            dst[i] = static_cast<T>(dst[i] + src[i]);
+        }
+        else {
+            dst[i] = static_cast<T>(dst[i] - src[i]);
+        }
+    }
+}
+
+template <class T>
+constexpr auto scale(isa level, T* dst, std::size_t count, T factor)
+{
+    if constexpr (Vectorizable<T>) {
+        switch (level) {
+#if defined(MTL_SIMD_X86)
+            case isa::avx512:
+                return kernels<isa::avx512>::scale(dst, count, factor);
+            case isa::avx2:
+                return kernels<isa::avx2>::scale(dst, count, factor);
+#elif defined(MTL_SIMD_NEON)
+            case isa::neon:
+                return kernels<isa::neon>::scale(dst, count, factor);
+#endif
+            default: break;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<T>(dst[i] * factor);
+    }
+}
+
+template <class T>
+constexpr auto fill(isa level, T* dst, std::size_t count, T value)
+{
+    if constexpr (Vectorizable<T>) {
+        switch (level) {
+#if defined(MTL_SIMD_X86)
+            case isa::avx512:
+                return kernels<isa::avx512>::fill(dst, count, value);
+            case isa::avx2:
+                return kernels<isa::avx2>::fill(dst, count, value);
+#elif defined(MTL_SIMD_NEON)
+            case isa::neon:
+                return kernels<isa::neon>::fill(dst, count, value);
+#endif
+            default: break;
+        }
+    }
+
+    std::fill_n(dst, count, value);
+}
+
+template <class T>
+constexpr auto equal(isa level, const T* lhs, const T* rhs, std::size_t count)
+    -> bool
+{
+    if constexpr (Vectorizable<T>) {
+        switch (level) {
+#if defined(MTL_SIMD_X86)
+            case isa::avx512:
+                return kernels<isa::avx512>::equal(lhs, rhs, count);
+            case isa::avx2:
+                return kernels<isa::avx2>::equal(lhs, rhs, count);
+#elif defined(MTL_SIMD_NEON)
+            case isa::neon:
+                return kernels<isa::neon>::equal(lhs, rhs, count);
+#endif
+            default: break;
+        }
+    }
+
+    return std::equal(lhs, lhs + count, rhs);
+}
+
+template <class T>
+constexpr auto dot(isa level, const T* lhs, const T* rhs, std::size_t count)
+    -> T
+{
+    if constexpr (Vectorizable<T>) {
+        switch (level) {
+#if defined(MTL_SIMD_X86)
+            case isa::avx512:
+                return kernels<isa::avx512>::dot(lhs, rhs, count);
+            case isa::avx2:
+                return kernels<isa::avx2>::dot(lhs, rhs, count);
+#elif defined(MTL_SIMD_NEON)
+            case isa::neon:
+                return kernels<isa::neon>::dot(lhs, rhs, count);
+#endif
+            default: break;
+        }
+    }
+
+    T sum{};
+    for (std::size_t i = 0; i < count; ++i) {
+        sum = static_cast<T>(sum + lhs[i] * rhs[i]);
+    }
+    return sum;
+}
+
+// Dot product of low-precision vectors, accumulated in float.
+template <Widenable T>
+constexpr auto widening_dot(
+    [[maybe_unused]] isa level,
+    const T* lhs,
+    const T* rhs,
+    std::size_t count) -> float
+{
+    switch (level) {
+#if defined(MTL_SIMD_X86)
+        case isa::avx512:
+            return kernels<isa::avx512>::widening_dot(lhs, rhs, count);
+        case isa::avx2:
+            return kernels<isa::avx2>::widening_dot(lhs, rhs, count);
+#endif
+        default: break;
+    }
+
+    float sum{};
+    for (std::size_t i = 0; i < count; ++i) {
+        sum += static_cast<float>(lhs[i]) * static_cast<float>(rhs[i]);
+    }
+    return sum;
+}
+
+template <reduction R, class T>
+constexpr auto reduce(isa level, const T* elems, std::size_t count)
+    -> reduction_t<R, T>
+{
+    // The vector kernels accumulate in lanes of the element type.
+    if constexpr (Vectorizable<T> and std::is_same_v<reduction_t<R, T>, T>) {
+        switch (level) {
+#if defined(MTL_SIMD_X86)
+            case isa::avx512:
+                return kernels<isa::avx512>::reduce<R>(elems, count);
+            case isa::avx2:
+                return kernels<isa::avx2>::reduce<R>(elems, count);
+#elif defined(MTL_SIMD_NEON)
+            case isa::neon:
+                return kernels<isa::neon>::reduce<R>(elems, count);
+#endif
+            default: break;
+        }
+    }
+
+    return reduce_strided<R>(elems, count, 1);
+}
+
+template <class T>
+constexpr auto level_for(std::size_t count) noexcept -> isa
+{
+    if (std::is_constant_evaluated() or not(Vectorizable<T> or Widenable<T>)
+        or count < dispatch_threshold) {
+        return isa::scalar;
+    }
+    return detected_isa();
+}
+
+template <class T>
+constexpr auto add(T* dst, const T* src, std::size_t count)
+{
+    binary<op::add>(level_for<T>(count), dst, src, count);
+}
+
+template <class T>
+constexpr auto sub(T* dst, const T* src, std::size_t count)
+{
+    binary<op::sub>(level_for<T>(count), dst, src, count);
+}
+
+template <class T>
+constexpr auto scale(T* dst, std::size_t count, T factor)
+{
+    scale(level_for<T>(count), dst, count, factor);
+}
+
+template <class T>
+constexpr auto fill(T* dst, std::size_t count, T value)
+{
+    fill(level_for<T>(count), dst, count, value);
+}
+
+template <class T>
+constexpr auto equal(const T* lhs, const T* rhs, std::size_t count) -> bool
+{
+    return equal(level_for<T>(count), lhs, rhs, count);
+}
+
+template <class T>
+constexpr auto dot(const T* lhs, const T* rhs, std::size_t count) -> T
+{
+    return dot(level_for<T>(count), lhs, rhs, count);
+}
+
+template <Widenable T>
+constexpr auto widening_dot(const T* lhs, const T* rhs, std::size_t count)
+    -> float
+{
+    return widening_dot(level_for<T>(count), lhs, rhs, count);
+}
+
+template <reduction R, class T>
+constexpr auto reduce(const T* elems, std::size_t count) -> reduction_t<R, T>
+{
+    return reduce<R>(level_for<T>(count), elems, count);
+}
+
+}  // namespace simd
+
+// Blocking parameters of the matrix multiplication kernel. A kc x nr panel
+// of the right-hand side is meant to stay in L1, an mc x kc block of the
+// left-hand side in L2, and the micro-kernel keeps an mr x nr tile of the
+// result in registers.
+template <class T>
+struct gemm_blocking {
+    static constexpr std::size_t mr = 4;
+    static constexpr std::size_t nr =
+        std::clamp<std::size_t>(64 / sizeof(T), 4, 16);
+    static constexpr std::size_t kc = 256;
+    static constexpr std::size_t mc = 128;
+    static constexpr std::size_t nc = 2048;
+    static constexpr std::size_t small_volume = 16 * 16 * 16;
+    static constexpr std::size_t parallel_volume = 128 * 128 * 128;
+};
+
+template <class Tc, class Ta>
+constexpr auto pack_a(
+    std::size_t mc,
+    std::size_t kc,
+    const Ta* a,
+    std::size_t rsa,
+    std::size_t csa,
+    Tc* buffer) noexcept
+{
+    constexpr auto mr = gemm_blocking<Tc>::mr;
+    for (std::size_t i = 0; i < mc; i += mr) {
+        const auto rows = std::min(mr, mc - i);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t r = 0; r < mr; ++r) {
+                *buffer++ = r < rows
+                                ? static_cast<Tc>(a[(i + r) * rsa + p * csa])
+                                : Tc{};
+            }
+        }
+    }
+}
+
+template <class Tc, class Tb>
+constexpr auto pack_b(
+    std::size_t kc,
+    std::size_t nc,
+    const Tb* b,
+    std::size_t rsb,
+    std::size_t csb,
+    Tc* buffer) noexcept
+{
+    constexpr auto nr = gemm_blocking<Tc>::nr;
+    for (std::size_t j = 0; j < nc; j += nr) {
+        const auto cols = std::min(nr, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t c = 0; c < nr; ++c) {
+                *buffer++ = c < cols
+                                ? static_cast<Tc>(b[p * rsb + (j + c) * csb])
+                                : Tc{};
+            }
+        }
+    }
+}
+
+// Panels are packed in the accumulator type Acc, which may be wider than the
+// type Tc of the result; the tile is narrowed once, when it is stored.
+template <class Acc, class Tc>
+constexpr auto gemm_micro_kernel(
+    std::size_t kc,
+    const Acc* a_panel,
+    const Acc* b_panel,
+    Acc alpha,
+    Tc* c,
+    std::size_t rsc,
+    std::size_t rows,
+    std::size_t cols) noexcept
+{
+    constexpr auto mr = gemm_blocking<Acc>::mr;
+    constexpr auto nr = gemm_blocking<Acc>::nr;
+
+    std::array<std::array<Acc, nr>, mr> acc{};
+    for (std::size_t p = 0; p < kc; ++p) {
+        for (std::size_t i = 0; i < mr; ++i) {
+            const auto a_elem = a_panel[p * mr + i];
+            for (std::size_t j = 0; j < nr; ++j) {
+                acc[i][j] =
+                    static_cast<Acc>(acc[i][j] + a_elem * b_panel[p * nr + j]);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            c[i * rsc + j] = static_cast<Tc>(
+                static_cast<Acc>(c[i * rsc + j]) + alpha * acc[i][j]);
+        }
+    }
+}
+
+// Number of elements below which an element-wise loop is not worth handing
+// to the thread pool.
+static inline constexpr std::size_t elementwise_grain = 16384;
+
+// Packing buffers of the calling thread. They only ever grow, so repeated
+// products of the same shape stop allocating after the first one.
+template <class T>
+inline auto pack_buffers(std::size_t a_size, std::size_t b_size)
+    -> std::pair<T*, T*>
+{
+    thread_local std::vector<T> a_pack;
+    thread_local std::vector<T> b_pack;
+    if (a_pack.size() < a_size) { a_pack.resize(a_size); }
+    if (b_pack.size() < b_size) { b_pack.resize(b_size); }
+    return { a_pack.data(), b_pack.data() };
+}
+
+// Computes c = alpha * a * b + beta * c for the row-major m x n matrix c,
+// where a and b are addressed through row and column strides so that
+// transposed or strided operands can be consumed without materializing them.
+// Products are summed in Acc, the type of alpha and beta. As in BLAS, c is
+// not read when beta is zero.
+template <class Acc, class Tc, class Ta, class Tb>
+constexpr auto gemm(
+    std::size_t m,
+    std::size_t n,
+    std::size_t k,
+    Acc alpha,
+    const Ta* a,
+    std::size_t rsa,
+    std::size_t csa,
+    const Tb* b,
+    std::size_t rsb,
+    std::size_t csb,
+    Acc beta,
+    Tc* c,
+    std::size_t rsc)
+{
+    using blocking = gemm_blocking<Acc>;
+
+    for (std::size_t i = 0; i < m; ++i) {
+        auto* row = c + i * rsc;
+        if (beta == Acc{}) { std::fill_n(row, n, Tc{}); }
+        else if (beta != Acc{ 1 }) {
+            std::transform(row, row + n, row, [beta](Tc elem) {
+                return static_cast<Tc>(beta * static_cast<Acc>(elem));
+            });
+        }
+    }
+
+    if (m * n * k <= blocking::small_volume) {
+        if constexpr (is_same_v<Tc, Acc>) {
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t p = 0; p < k; ++p) {
+                    const auto a_elem = static_cast<Acc>(
+                        alpha * static_cast<Acc>(a[i * rsa + p * csa]));
+                    for (std::size_t j = 0; j < n; ++j) {
+                        c[i * rsc + j] = static_cast<Tc>(
+                            c[i * rsc + j]
+                            + a_elem * static_cast<Acc>(b[p * rsb + j * csb]));
+                    }
+                }
+            }
+        }
+        else {
+            // A narrower result cannot hold partial sums.
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    Acc sum{};
+                    for (std::size_t p = 0; p < k; ++p) {
+                        sum = static_cast<Acc>(
+                            sum
+                            + static_cast<Acc>(a[i * rsa + p * csa])
+                                  * static_cast<Acc>(b[p * rsb + j * csb]));
+                    }
+                    c[i * rsc + j] = static_cast<Tc>(
+                        static_cast<Acc>(c[i * rsc + j]) + alpha * sum);
+                }
+            }
+        }
+        return;
+    }
+
+    const auto round_up = [](std::size_t value, std::size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    };
 
-template <class At_, class Au_>
-static inline constexpr auto is_same_v = std::is_same<At_, Au_>::value;
+    const auto kc_max = std::min(k, blocking::kc);
+    const auto [a_pack, b_pack] = pack_buffers<Acc>(
+        round_up(std::min(m, blocking::mc), blocking::mr) * kc_max,
+        round_up(std::min(n, blocking::nc), blocking::nr) * kc_max);
+
+    for (std::size_t jc = 0; jc < n; jc += blocking::nc) {
+        const auto nc = std::min(blocking::nc, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += blocking::kc) {
+            const auto kc = std::min(blocking::kc, k - pc);
+            pack_b(kc, nc, b + pc * rsb + jc * csb, rsb, csb, b_pack);
+
+            for (std::size_t ic = 0; ic < m; ic += blocking::mc) {
+                const auto mc = std::min(blocking::mc, m - ic);
+                pack_a(
+                    mc,
+                    kc,
+                    a + ic * rsa + pc * csa,
+                    rsa,
+                    csa,
+                    a_pack);
+
+                for (std::size_t jr = 0; jr < nc; jr += blocking::nr) {
+                    for (std::size_t ir = 0; ir < mc; ir += blocking::mr) {
+                        gemm_micro_kernel(
+                            kc,
+                            a_pack + ir * kc,
+                            b_pack + jr * kc,
+                            alpha,
+                            c + (ic + ir) * rsc + jc + jr,
+                            rsc,
+                            std::min(blocking::mr, mc - ir),
+                            std::min(blocking::nr, nc - jr));
+                    }
+                }
+            }
+        }
+    }
+}
 
-template <class At_, class Au_>
-static inline constexpr auto is_convertible_v =
-    std::is_convertible<Au_, Au_>::value;
+// Product of operands whose extents all fit inline storage, with every loop
+// unrolled at compile time: c (M x N) = a (M x K) * b (K x N).
+template <std::size_t N, std::size_t K, class Tc, class Ta, class Tb>
+struct fixed_gemm_kernel {
+    using acc_type = accumulator_t<Tc, Ta, Tb>;
+
+    template <std::size_t Idx, std::size_t... P>
+    static constexpr auto dot(
+        const Ta* a,
+        const Tb* b,
+        std::index_sequence<P...>) noexcept -> Tc
+    {
+        return static_cast<Tc>(
+            (acc_type{} + ...
+             + static_cast<acc_type>(
+                 static_cast<acc_type>(a[Idx / N * K + P])
+                 * static_cast<acc_type>(b[P * N + Idx % N]))));
+    }
 
-// clang-format off
-template <typename Ta_>
-concept Arithmetic = is_arithmetic_v<Ta_> and requires(Ta_ a_type) {
-    a_type + a_type;
-    a_type - a_type;
-    a_type * a_type;
-    a_type == a_type;
-    a_type != a_type;
+    template <std::size_t... Idx>
+    static constexpr auto run(
+        const Ta* a,
+        const Tb* b,
+        Tc* c,
+        std::index_sequence<Idx...>) noexcept
+    {
+        ((c[Idx] = dot<Idx>(a, b, std::make_index_sequence<K>{})), ...);
+    }
 };
 
-template <class Ta_, class Tb_>
-concept Scalar = std::is_scalar_v<Tb_>
-                 and requires(Ta_ a_type, Tb_ b_type) { a_type * b_type; };
-// clang-format on
+template <
+    std::size_t M,
+    std::size_t N,
+    std::size_t K,
+    class Tc,
+    class Ta,
+    class Tb>
+constexpr auto fixed_gemm(const Ta* a, const Tb* b, Tc* c) noexcept
+{
+    fixed_gemm_kernel<N, K, Tc, Ta, Tb>::run(
+        a,
+        b,
+        c,
+        std::make_index_sequence<M * N>{});
+}
+
+// In-place LU factorization with partial pivoting of the row-major n x n
+// matrix `a`. On return the strict lower triangle holds the multipliers of
+// the unit lower factor and the upper triangle holds U. At step i, row i was
+// swapped with row pivots[i] (not recorded when `pivots` is null). Returns
+// the sign of the row permutation; a singular matrix leaves a zero on the
+// diagonal of U.
+template <execution::Policy P, class T>
+constexpr auto lu_factor(
+    const P& policy,
+    T* a,
+    std::size_t n,
+    std::size_t* pivots) -> int
+{
+#if defined(MTL_USE_BLAS)
+    if constexpr (blas::Supported<T>) {
+        if (n >= blas::min_size) { return blas::lu_factor(a, n, pivots); }
+    }
+#endif
+
+    constexpr auto magnitude = [](T value) {
+        return value < T{} ? -value : value;
+    };
+
+    int sign = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t pivot = i;
+        for (std::size_t k = i + 1; k < n; ++k) {
+            if (magnitude(a[k * n + i]) > magnitude(a[pivot * n + i])) {
+                pivot = k;
+            }
+        }
+
+        if (pivots != nullptr) { pivots[i] = pivot; }
+        if (a[pivot * n + i] == T{}) { continue; }
+
+        if (pivot != i) {
+            std::swap_ranges(a + i * n, a + (i + 1) * n, a + pivot * n);
+            sign = -sign;
+        }
+
+        const auto* pivot_row = a + i * n;
+        for_each_chunk(
+            policy,
+            n - i - 1,
+            std::max<std::size_t>(elementwise_grain / n, 1),
+            [a, n, i, pivot_row](std::size_t begin, std::size_t end) {
+                for (auto k = i + 1 + begin; k < i + 1 + end; ++k) {
+                    auto* row = a + k * n;
+                    const auto factor = static_cast<T>(row[i] / pivot_row[i]);
+                    row[i] = factor;
+                    for (std::size_t j = i + 1; j < n; ++j) {
+                        row[j] =
+                            static_cast<T>(row[j] - factor * pivot_row[j]);
+                    }
+                }
+            });
+    }
+
+    return sign;
+}
+
+// Closed-form determinant of an N x N matrix, N <= 4, whose elements are
+// at(i, j). The 4 x 4 case expands along the first two rows, pairing each
+// of their 2 x 2 minors with the complementary minor of the last two rows.
+template <std::size_t N, class At>
+constexpr auto small_det(const At& at) noexcept -> double
+{
+    if constexpr (N == 1) { return at(0, 0); }
+    else if constexpr (N == 2) {
+        return at(0, 0) * at(1, 1) - at(0, 1) * at(1, 0);
+    }
+    else if constexpr (N == 3) {
+        return at(0, 0) * (at(1, 1) * at(2, 2) - at(1, 2) * at(2, 1))
+               - at(0, 1) * (at(1, 0) * at(2, 2) - at(1, 2) * at(2, 0))
+               + at(0, 2) * (at(1, 0) * at(2, 1) - at(1, 1) * at(2, 0));
+    }
+    else {
+        // Minor of rows row and row + 1 and columns i and j.
+        const auto cross =
+            [&at](std::size_t row, std::size_t i, std::size_t j) {
+                return at(row, i) * at(row + 1, j)
+                       - at(row, j) * at(row + 1, i);
+            };
+        return cross(0, 0, 1) * cross(2, 2, 3)
+               - cross(0, 0, 2) * cross(2, 1, 3)
+               + cross(0, 0, 3) * cross(2, 1, 2)
+               + cross(0, 1, 2) * cross(2, 0, 3)
+               - cross(0, 1, 3) * cross(2, 0, 2)
+               + cross(0, 2, 3) * cross(2, 0, 1);
+    }
+}
+
+// Splits the product into independent slabs of rows (or of columns, when
+// the result is wide) and runs the blocked kernel on each of them. Every
+// slab packs its own panels, so no synchronization is needed in the kernel.
+template <execution::Policy P, class Acc, class Tc, class Ta, class Tb>
+constexpr auto gemm(
+    const P& policy,
+    std::size_t m,
+    std::size_t n,
+    std::size_t k,
+    Acc alpha,
+    const Ta* a,
+    std::size_t rsa,
+    std::size_t csa,
+    const Tb* b,
+    std::size_t rsb,
+    std::size_t csb,
+    Acc beta,
+    Tc* c,
+    std::size_t rsc)
+{
+    using blocking = gemm_blocking<Acc>;
+
+#if defined(MTL_USE_BLAS)
+    // The library threads the product itself.
+    if constexpr (
+        blas::Supported<Acc> and is_same_v<Tc, Acc> and is_same_v<Ta, Acc>
+        and is_same_v<Tb, Acc>) {
+        const auto handled = blas::gemm(
+            m,
+            n,
+            k,
+            alpha,
+            a,
+            rsa,
+            csa,
+            b,
+            rsb,
+            csb,
+            beta,
+            c,
+            rsc);
+        if (handled) { return; }
+    }
+#endif
+
+    if (m * n * k <= blocking::parallel_volume) {
+        gemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc);
+    }
+    else if (m >= n) {
+        for_each_chunk(
+            policy,
+            m,
+            blocking::mc,
+            [=](std::size_t begin, std::size_t end) {
+                gemm(
+                    end - begin,
+                    n,
+                    k,
+                    alpha,
+                    a + begin * rsa,
+                    rsa,
+                    csa,
+                    b,
+                    rsb,
+                    csb,
+                    beta,
+                    c + begin * rsc,
+                    rsc);
+            });
+    }
+    else {
+        for_each_chunk(
+            policy,
+            n,
+            blocking::mc,
+            [=](std::size_t begin, std::size_t end) {
+                gemm(
+                    m,
+                    end - begin,
+                    k,
+                    alpha,
+                    a,
+                    rsa,
+                    csa,
+                    b + begin * csb,
+                    rsb,
+                    csb,
+                    beta,
+                    c + begin,
+                    rsc);
+            });
+    }
+}
+
+// Computes y = alpha * a * x + beta * y for the m x n matrix a addressed
+// through row and column strides, summing products in Acc, the type of alpha
+// and beta. As in BLAS, y is not read when beta is zero, so it may hold
+// anything, NaNs included.
+template <class Acc, class Ty, class Ta, class Tx>
+constexpr auto gemv(
+    std::size_t m,
+    std::size_t n,
+    Acc alpha,
+    const Ta* a,
+    std::size_t rsa,
+    std::size_t csa,
+    const Tx* x,
+    Acc beta,
+    Ty* y)
+{
+    const auto update = [alpha, beta](Acc sum, Ty previous) {
+        return static_cast<Ty>(
+            beta == Acc{} ? alpha * sum
+                          : alpha * sum + beta * static_cast<Acc>(previous));
+    };
+
+    // Column by column accumulation keeps partial sums in y, so it is only
+    // used when y is as wide as the accumulator.
+    if (csa == 1 or rsa != 1 or not is_same_v<Ty, Acc>) {
+        for (std::size_t i = 0; i < m; ++i) {
+            const auto* row = a + i * rsa;
+            if constexpr (is_same_v<Ta, Acc> and is_same_v<Tx, Acc>) {
+                if (csa == 1) {
+                    y[i] = update(simd::dot(row, x, n), y[i]);
+                    continue;
+                }
+            }
+            else if constexpr (
+                is_same_v<Ta, Tx> and simd::Widenable<Ta>
+                and is_same_v<Acc, float>) {
+                if (csa == 1) {
+                    y[i] = update(simd::widening_dot(row, x, n), y[i]);
+                    continue;
+                }
+            }
+            Acc sum{};
+            for (std::size_t j = 0; j < n; ++j) {
+                sum = static_cast<Acc>(
+                    sum
+                    + static_cast<Acc>(row[j * csa]) * static_cast<Acc>(x[j]));
+            }
+            y[i] = update(sum, y[i]);
+        }
+        return;
+    }
+
+    // Contiguous columns, as in a transposed operand: accumulate column by
+    // column so that the inner loop streams both a and y.
+    for (std::size_t i = 0; i < m; ++i) {
+        y[i] = beta == Acc{} ? Ty{} : static_cast<Ty>(beta * y[i]);
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+        const auto* col = a + j * csa;
+        const auto factor = static_cast<Acc>(alpha * static_cast<Acc>(x[j]));
+        for (std::size_t i = 0; i < m; ++i) {
+            y[i] = static_cast<Ty>(y[i] + factor * static_cast<Acc>(col[i]));
+        }
+    }
+}
+
+template <execution::Policy P, class Acc, class Ty, class Ta, class Tx>
+constexpr auto gemv(
+    const P& policy,
+    std::size_t m,
+    std::size_t n,
+    Acc alpha,
+    const Ta* a,
+    std::size_t rsa,
+    std::size_t csa,
+    const Tx* x,
+    Acc beta,
+    Ty* y)
+{
+#if defined(MTL_USE_BLAS)
+    if constexpr (
+        blas::Supported<Acc> and is_same_v<Ty, Acc> and is_same_v<Ta, Acc>
+        and is_same_v<Tx, Acc>) {
+        if (blas::gemv(m, n, alpha, a, rsa, csa, x, beta, y)) { return; }
+    }
+#endif
+
+    if (m * n <= elementwise_grain) {
+        gemv(m, n, alpha, a, rsa, csa, x, beta, y);
+        return;
+    }
+    const auto rows_per_chunk = std::max<std::size_t>(
+        elementwise_grain / std::max<std::size_t>(n, 1),
+        1);
+    for_each_chunk(
+        policy,
+        m,
+        rows_per_chunk,
+        [=](std::size_t begin, std::size_t end) {
+            gemv(
+                end - begin,
+                n,
+                alpha,
+                a + begin * rsa,
+                rsa,
+                csa,
+                x,
+                beta,
+                y + begin);
+        });
+}
+
+// Transposes tile by tile, so that the rows read and the rows written by a
+// tile both stay in L1 instead of every store of a column walk missing.
+static inline constexpr std::size_t transpose_tile = 32;
+
+template <class T>
+constexpr auto transpose_blocked(
+    const T* src,
+    std::size_t rows,
+    std::size_t cols,
+    T* dst) noexcept
+{
+    for (std::size_t ii = 0; ii < rows; ii += transpose_tile) {
+        const auto i_end = std::min(ii + transpose_tile, rows);
+        for (std::size_t jj = 0; jj < cols; jj += transpose_tile) {
+            const auto j_end = std::min(jj + transpose_tile, cols);
+            for (auto i = ii; i < i_end; ++i) {
+                for (auto j = jj; j < j_end; ++j) {
+                    dst[j * rows + i] = src[i * cols + j];
+                }
+            }
+        }
+    }
+}
+
+// In-place transpose of a square n x n block: every tile above the diagonal
+// is swapped with its mirror, diagonal tiles with themselves.
+template <class T>
+constexpr auto transpose_square(T* elems, std::size_t n) noexcept
+{
+    for (std::size_t ii = 0; ii < n; ii += transpose_tile) {
+        const auto i_end = std::min(ii + transpose_tile, n);
+        for (auto jj = ii; jj < n; jj += transpose_tile) {
+            const auto j_end = std::min(jj + transpose_tile, n);
+            for (auto i = ii; i < i_end; ++i) {
+                for (auto j = std::max(jj, i + 1); j < j_end; ++j) {
+                    std::swap(elems[i * n + j], elems[j * n + i]);
+                }
+            }
+        }
+    }
+}
 
 }  // namespace detail
 
@@ -55,18 +1642,157 @@ struct Row;
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 struct Crow;
 
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+struct Matrix;
+
+namespace detail {
+
+template <class M>
+struct is_matrix : std::false_type {};
+
+template <class T, std::size_t I, std::size_t J>
+struct is_matrix<Matrix<T, I, J>> : std::true_type {};
+
+template <class M>
+static inline constexpr bool is_matrix_v =
+    is_matrix<std::remove_cvref_t<M>>::value;
+
+template <class E>
+struct is_matrix_expression : std::false_type {};
+
+template <class E>
+static inline constexpr bool is_matrix_expression_v =
+    is_matrix_expression<std::remove_cvref_t<E>>::value;
+
+template <class E>
+concept MatrixExpression = is_matrix_expression_v<E>;
+
+template <class E>
+concept MatrixOperand = is_matrix_v<E> or is_matrix_expression_v<E>;
+
+template <class M>
+struct operand_traits {
+    using value_type = typename M::value_type;
+    using stored_type = M;
+    static constexpr std::size_t rows_extent = M::rows_extent;
+    static constexpr std::size_t cols_extent = M::cols_extent;
+    static constexpr bool fixed_shape = M::fixed_shape;
+};
+
+// Only inline matrices have a shape fully determined by their type; heap
+// backed fixed-extent matrices can still be reallocated at run time.
+template <class T, std::size_t I, std::size_t J>
+struct operand_traits<Matrix<T, I, J>> {
+    using value_type = T;
+    using stored_type = const Matrix<T, I, J>&;
+    static constexpr std::size_t rows_extent = I;
+    static constexpr std::size_t cols_extent = J;
+    static constexpr bool fixed_shape = use_inline_storage_v<I, J>;
+};
+
+template <class M>
+using operand_value_t = typename operand_traits<M>::value_type;
+
+template <std::size_t Extent, std::size_t Other>
+static inline constexpr bool extents_match_v =
+    Extent == Other or Extent == dynamic or Other == dynamic;
+
+// Operands whose fixed extents differ are rejected at compile time; sizes
+// that are only known at run time are checked by check_same_shape().
+template <class L, class R>
+concept SameShape =
+    extents_match_v<
+        operand_traits<std::remove_cvref_t<L>>::rows_extent,
+        operand_traits<std::remove_cvref_t<R>>::rows_extent>
+    and extents_match_v<
+        operand_traits<std::remove_cvref_t<L>>::cols_extent,
+        operand_traits<std::remove_cvref_t<R>>::cols_extent>;
+
+template <class L, class R>
+concept Multipliable = extents_match_v<
+    operand_traits<std::remove_cvref_t<L>>::cols_extent,
+    operand_traits<std::remove_cvref_t<R>>::rows_extent>;
+
+template <class L, class R>
+constexpr auto check_same_shape(const L& lhs, const R& rhs)
+{
+    if constexpr (not(operand_traits<L>::fixed_shape
+                      and operand_traits<R>::fixed_shape)) {
+        if (lhs.row_size() != rhs.row_size()
+            or lhs.col_size() != rhs.col_size()) {
+            throw std::logic_error{ "Matrix::invalid size" };
+        }
+    }
+}
+
+template <class L, class R>
+constexpr auto check_multipliable(const L& lhs, const R& rhs)
+{
+    if constexpr (not(operand_traits<L>::fixed_shape
+                      and operand_traits<R>::fixed_shape)) {
+        if (lhs.col_size() != rhs.row_size()) {
+            throw std::logic_error{ "Matrix::invalid size" };
+        }
+    }
+}
+
+template <
+    class T,
+    class U,
+    std::size_t I,
+    std::size_t J,
+    std::size_t A,
+    std::size_t B>
+using product_t = Matrix<
+    std::common_type_t<T, U>,
+    combined_extent_v<I, J, A, B>,
+    combined_extent_v<B, I, J, A>>;
+
+template <class L, class R>
+using operand_product_t = product_t<
+    operand_value_t<L>,
+    operand_value_t<R>,
+    operand_traits<L>::rows_extent,
+    operand_traits<L>::cols_extent,
+    operand_traits<R>::rows_extent,
+    operand_traits<R>::cols_extent>;
+
+}  // namespace detail
+
 // NOLINTBEGIN(hicpp-named-parameter,readability-named-parameter)
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 struct Matrix final {
+   public:
+    using value_type = T;
+
+    static constexpr bool has_inline_storage =
+        detail::use_inline_storage_v<I, J>;
+
+    static constexpr bool is_dynamic = I == dynamic;
+
+    static_assert(
+        (I == dynamic) == (J == dynamic),
+        "Matrix: either both extents or none of them can be dynamic");
+
    private:
-    T** data{ nullptr };
-    std::pair<std::size_t, std::size_t> size_{ I, J };
+    detail::storage_t<T, I, J> storage_{};
+    std::size_t rows_{ is_dynamic ? 0 : I };
+    std::size_t cols_{ is_dynamic ? 0 : J };
     bool has_been_reallocated{ false };
 
    public:
     constexpr Matrix() noexcept;
 
-    constexpr ~Matrix() noexcept;
+    constexpr Matrix(std::size_t, std::size_t, const T& = T{})
+        requires is_dynamic;
+
+    constexpr Matrix(detail::uninitialized_t, std::size_t, std::size_t);
+
+    constexpr ~Matrix() noexcept
+        requires has_inline_storage
+    = default;
+    constexpr ~Matrix() noexcept
+        requires(not has_inline_storage);
 
     explicit constexpr Matrix(const T&) noexcept;
 
@@ -79,25 +1805,57 @@ struct Matrix final {
     // NOLINTNEXTLINE(hicpp-explicit-conversions)
     constexpr Matrix(std::initializer_list<std::initializer_list<T>>);
 
-    constexpr Matrix(const Matrix<T, I, J>&) noexcept;
+    constexpr Matrix(const Matrix<T, I, J>&) noexcept
+        requires has_inline_storage
+    = default;
+    constexpr Matrix(const Matrix<T, I, J>&) noexcept
+        requires(not has_inline_storage);
+
     constexpr auto operator=(const Matrix<T, I, J>&) noexcept
-        -> Matrix<T, I, J>&;
+        -> Matrix<T, I, J>&
+        requires has_inline_storage
+    = default;
+    constexpr auto operator=(const Matrix<T, I, J>&) noexcept
+        -> Matrix<T, I, J>&
+        requires(not has_inline_storage);
 
     template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
     constexpr explicit Matrix(const Matrix<U, A, B>&);
 
     template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
     constexpr auto operator=(const Matrix<U, A, B>&) -> Matrix<T, I, J>&;
 
-    constexpr Matrix(Matrix<T, I, J>&&) noexcept;
-    constexpr auto operator=(Matrix<T, I, J>&&) noexcept -> Matrix<T, I, J>&;
+    constexpr Matrix(Matrix<T, I, J>&&) noexcept
+        requires has_inline_storage
+    = default;
+    constexpr Matrix(Matrix<T, I, J>&&) noexcept
+        requires(not has_inline_storage);
+
+    constexpr auto operator=(Matrix<T, I, J>&&) noexcept -> Matrix<T, I, J>&
+        requires has_inline_storage
+    = default;
+    constexpr auto operator=(Matrix<T, I, J>&&) noexcept -> Matrix<T, I, J>&
+        requires(not has_inline_storage);
 
     template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
     constexpr explicit Matrix(Matrix<U, A, B>&&);
 
     template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
     constexpr auto operator=(Matrix<U, A, B>&&) -> Matrix<T, I, J>&;
 
+    template <detail::MatrixExpression E>
+        requires detail::SameShape<Matrix<T, I, J>, E>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+    constexpr Matrix(const E&);
+
+    template <detail::MatrixExpression E>
+        requires detail::SameShape<Matrix<T, I, J>, E>
+    constexpr auto operator=(const E&) -> Matrix<T, I, J>&;
+
     template <detail::Arithmetic U>
     constexpr auto operator=(const std::initializer_list<U>&)
         -> Matrix<T, I, J>&;
@@ -106,9 +1864,18 @@ struct Matrix final {
     constexpr auto operator=(std::initializer_list<U>&&) -> Matrix<T, I, J>&;
 
     template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires(detail::combined_extent_v<I, J, A, B> != dynamic
+                 and A >= I and B >= J)
     explicit constexpr operator Matrix<U, A, B>() const;
 
-    [[nodiscard]] constexpr auto underlying_array() const noexcept -> T**;
+    [[nodiscard]] constexpr auto underlying_array() const noexcept -> T**
+        requires(not has_inline_storage);
+
+    [[nodiscard]] constexpr auto data() noexcept -> T*;
+    [[nodiscard]] constexpr auto data() const noexcept -> const T*;
+
+    [[nodiscard]] constexpr auto span() noexcept -> std::span<T>;
+    [[nodiscard]] constexpr auto span() const noexcept -> std::span<const T>;
 
     constexpr auto insert(const T&) noexcept;
 
@@ -116,12 +1883,32 @@ struct Matrix final {
 
     [[nodiscard]] constexpr auto transpose() const noexcept -> Matrix<T, J, I>;
 
-    [[nodiscard]] constexpr auto power(unsigned int) -> Matrix<T, I, J>;
+    constexpr auto transpose_inplace() -> Matrix<T, I, J>&
+        requires(I == J);
+
+    [[nodiscard]] constexpr auto power(unsigned int) const -> Matrix<T, I, J>
+        requires(I == J);
+
+    [[nodiscard]] constexpr auto det() const
+        requires(I == J);
 
-    [[nodiscard]] constexpr auto det() const;
+    template <execution::Policy P>
+    [[nodiscard]] constexpr auto det(const P&) const
+        requires(I == J);
 
+    // Structure queries. Each stops at the first element that rules the
+    // structure out, so a general matrix is usually rejected after a few
+    // elements; only a matrix that has the structure is scanned in full.
     [[nodiscard]] constexpr auto is_diagonal() const noexcept -> bool;
 
+    [[nodiscard]] constexpr auto is_identity() const noexcept -> bool;
+
+    [[nodiscard]] constexpr auto is_upper_triangular() const noexcept -> bool;
+
+    [[nodiscard]] constexpr auto is_lower_triangular() const noexcept -> bool;
+
+    [[nodiscard]] constexpr auto is_symmetric() const noexcept -> bool;
+
    private:
     constexpr auto zeros() noexcept;
 
@@ -133,8 +1920,23 @@ struct Matrix final {
     constexpr auto alloc(std::size_t, std::size_t) noexcept;
     constexpr auto alloc(std::size_t, std::size_t) const noexcept;
 
+    constexpr auto assign_shape(std::size_t, std::size_t) noexcept;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    friend struct Matrix;
+
    public:
-    constexpr auto realloc(std::size_t, std::size_t) noexcept;
+    constexpr auto realloc(std::size_t, std::size_t) noexcept
+        requires(not has_inline_storage and not is_dynamic);
+
+    constexpr auto resize(std::size_t, std::size_t)
+        requires is_dynamic;
+
+    constexpr auto reserve(std::size_t, std::size_t)
+        requires is_dynamic;
+
+    [[nodiscard]] constexpr auto capacity() const noexcept -> std::size_t
+        requires is_dynamic;
 
     constexpr auto dealloc() noexcept;
     constexpr auto dealloc() const noexcept;
@@ -150,155 +1952,446 @@ struct Matrix final {
 
     constexpr auto clear() noexcept;
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    constexpr auto operator+=(const Matrix<U, A, B>&) -> Matrix<T, I, J>&;
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
+    constexpr auto operator+=(const Matrix<U, A, B>&) -> Matrix<T, I, J>&;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
+    constexpr auto operator-=(const Matrix<U, A, B>&) -> Matrix<T, I, J>&;
+
+    template <detail::MatrixExpression E>
+        requires detail::SameShape<Matrix<T, I, J>, E>
+    constexpr auto operator+=(const E&) -> Matrix<T, I, J>&;
+
+    template <detail::MatrixExpression E>
+        requires detail::SameShape<Matrix<T, I, J>, E>
+    constexpr auto operator-=(const E&) -> Matrix<T, I, J>&;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+        requires(detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+                 and detail::extents_match_v<J, B>)
+    constexpr auto operator*=(const Matrix<U, A, B>&) -> Matrix<T, I, J>&;
+
+    template <detail::Scalar<T> U>
+    constexpr auto operator*=(const U&) -> Matrix<T, I, J>&;
+
+    template <detail::Scalar<T> U>
+    constexpr auto operator*=(const std::vector<U>&) -> Matrix<T, I, J>&;
+
+    constexpr auto operator^(const unsigned int&) -> Matrix<T, I, J>&
+        requires(I == J);
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    [[nodiscard]] constexpr inline auto operator==(
+        const Matrix<U, A, B>&) const noexcept -> bool;
+
+    template <detail::Arithmetic U>
+    [[nodiscard]] constexpr inline auto operator==(
+        const std::initializer_list<U>&) const noexcept -> bool;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    [[nodiscard]] constexpr inline auto operator!=(
+        const Matrix<U, A, B>&) const noexcept -> bool;
+
+    constexpr auto operator[](std::size_t) -> Row<T, I, J>;
+
+    constexpr auto operator[](std::size_t) const -> Crow<T, I, J>;
+
+    constexpr auto operator()(std::size_t, std::size_t) -> T&;
+    constexpr auto operator()(std::size_t, std::size_t) const -> const T&;
+
+    constexpr auto at(std::size_t, std::size_t) -> T&;
+    constexpr auto at(std::size_t, std::size_t) const -> const T&;
+
+    // Element access without any bounds check, for inner loops.
+    [[nodiscard]] constexpr auto unchecked(std::size_t, std::size_t) noexcept
+        -> T&;
+    [[nodiscard]] constexpr auto unchecked(std::size_t, std::size_t)
+        const noexcept -> const T&;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    friend constexpr auto operator<<(std::ostream&, const Matrix<U, A, B>&)
+        -> std::ostream&;
+
+    // The elements are one row-major array, so the iterators are pointers:
+    // Matrix is a std::ranges::contiguous_range, and standard algorithms,
+    // parallel ones included, run over it as over a plain array.
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    [[nodiscard]] constexpr auto begin() noexcept -> iterator;
+    [[nodiscard]] constexpr auto end() noexcept -> iterator;
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator;
+    [[nodiscard]] constexpr auto end() const noexcept -> const_iterator;
+
+    [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator;
+    [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator;
+};
+
+// Row and Crow are non-owning views of a single matrix row. They stay valid
+// as long as the matrix they were taken from is neither destroyed nor
+// reallocated; get_row() makes an owning copy.
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+struct Row {
+   private:
+    T* row;
+    std::size_t n_cols;
+
+   public:
+    constexpr explicit Row(Matrix<T, I, J>&, std::size_t) noexcept;
+    constexpr ~Row() = default;
+    constexpr Row(const Row&) noexcept = default;
+    constexpr Row(Row&&) noexcept = default;
+    constexpr auto operator=(const Row&) -> Row<T, I, J>& = delete;
+    constexpr auto operator=(Row&&) -> Row<T, I, J>& = delete;
+    constexpr auto operator=(const std::vector<T>&) -> Row<T, I, J>&;
+
+    constexpr auto operator[](std::size_t) const -> T&;
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t;
+    [[nodiscard]] constexpr auto data() const noexcept -> T*;
+
+    constexpr auto begin() const noexcept -> T*;
+    constexpr auto end() const noexcept -> T*;
+
+    [[nodiscard]] auto get_row() const -> std::vector<T>;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    friend auto operator<<(std::ostream&, const Row&) -> std::ostream&;
+};
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+struct Crow {
+   private:
+    const T* row;
+    std::size_t n_cols;
+
+   public:
+    constexpr explicit Crow(const Matrix<T, I, J>&, std::size_t) noexcept;
+    constexpr ~Crow() = default;
+    constexpr Crow(const Crow&) noexcept = default;
+    constexpr Crow(Crow&&) noexcept = default;
+    constexpr auto operator=(const Crow&) -> Crow<T, I, J>& = delete;
+    constexpr auto operator=(Crow&&) -> Crow<T, I, J>& = delete;
+
+    constexpr auto operator[](std::size_t) const -> const T&;
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t;
+    [[nodiscard]] constexpr auto data() const noexcept -> const T*;
+
+    constexpr auto begin() const noexcept -> const T*;
+    constexpr auto end() const noexcept -> const T*;
+
+    [[nodiscard]] auto get_row() const -> std::vector<T>;
+
+    template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    friend auto operator<<(std::ostream&, const Crow&) -> std::ostream&;
+};
+// NOLINTEND(hicpp-named-parameter,readability-named-parameter)
+
+namespace detail {
+
+template <class M>
+constexpr auto element_of(const M& operand, std::size_t index)
+{
+    if constexpr (is_matrix_v<M>) { return operand.data()[index]; }
+    else {
+        return operand.element(index);
+    }
+}
+
+template <MatrixOperand M>
+constexpr auto evaluate(const M& operand) -> decltype(auto)
+{
+    if constexpr (is_matrix_v<M>) { return (operand); }
+    else {
+        instrumentation::detail::record_temporary(
+            operand.row_size() * operand.col_size()
+            * sizeof(operand_value_t<M>));
+        return Matrix<
+            operand_value_t<M>,
+            operand_traits<M>::rows_extent,
+            operand_traits<M>::cols_extent>{ operand };
+    }
+}
+
+struct plus_op {
+    template <class Ta, class Tb>
+    constexpr auto operator()(const Ta& lhs, const Tb& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+struct minus_op {
+    template <class Ta, class Tb>
+    constexpr auto operator()(const Ta& lhs, const Tb& rhs) const
+    {
+        return lhs - rhs;
+    }
+};
+
+// Lazy element-wise expressions. Matrix operands are held by reference and
+// nested expressions by value, so an expression must not outlive the matrices
+// it was built from; assigning it to a Matrix evaluates it in a single pass.
+template <class Op, MatrixOperand Lhs, MatrixOperand Rhs>
+struct binary_expression {
+    using value_type =
+        std::common_type_t<operand_value_t<Lhs>, operand_value_t<Rhs>>;
+    static constexpr std::size_t rows_extent = combined_extent_v<
+        operand_traits<Lhs>::rows_extent,
+        operand_traits<Rhs>::rows_extent>;
+    static constexpr std::size_t cols_extent = combined_extent_v<
+        operand_traits<Lhs>::cols_extent,
+        operand_traits<Rhs>::cols_extent>;
+
+    static constexpr bool fixed_shape = operand_traits<Lhs>::fixed_shape
+                                        and operand_traits<Rhs>::fixed_shape;
+
+    constexpr binary_expression(const Lhs& lhs, const Rhs& rhs)
+        : lhs_{ lhs }, rhs_{ rhs }
+    {
+        check_same_shape(lhs, rhs);
+    }
+
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return lhs_.row_size();
+    }
+
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return lhs_.col_size();
+    }
+
+    [[nodiscard]] constexpr auto element(std::size_t index) const
+        -> value_type
+    {
+        return static_cast<value_type>(Op{}(
+            static_cast<value_type>(element_of(lhs_, index)),
+            static_cast<value_type>(element_of(rhs_, index))));
+    }
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    constexpr auto operator-=(const Matrix<U, A, B>&) -> Matrix<T, I, J>&;
+    [[nodiscard]] constexpr auto lhs() const noexcept -> const Lhs&
+    {
+        return lhs_;
+    }
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    constexpr auto operator*=(const Matrix<U, A, B>&) -> Matrix<T, I, B>&;
+    [[nodiscard]] constexpr auto rhs() const noexcept -> const Rhs&
+    {
+        return rhs_;
+    }
 
-    template <detail::Scalar<T> U>
-    constexpr auto operator*=(const U&) -> Matrix<T, I, J>&;
+   private:
+    typename operand_traits<Lhs>::stored_type lhs_;
+    typename operand_traits<Rhs>::stored_type rhs_;
+};
 
-    template <detail::Scalar<T> U>
-    constexpr auto operator*=(const std::vector<U>&) -> Matrix<T, I, J>&;
+template <MatrixOperand M, class S>
+struct scaled_expression {
+    using value_type = std::common_type_t<operand_value_t<M>, S>;
+    static constexpr std::size_t rows_extent = operand_traits<M>::rows_extent;
+    static constexpr std::size_t cols_extent = operand_traits<M>::cols_extent;
+    static constexpr bool fixed_shape = operand_traits<M>::fixed_shape;
 
-    constexpr auto operator^(const unsigned int&) -> Matrix<T, I, J>&;
+    constexpr scaled_expression(const M& operand, const S& scalar)
+        : operand_{ operand }, scalar_{ scalar }
+    {
+    }
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    [[nodiscard]] constexpr inline auto operator==(
-        const Matrix<U, A, B>&) const noexcept -> bool;
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return operand_.row_size();
+    }
 
-    template <detail::Arithmetic U>
-    [[nodiscard]] constexpr inline auto operator==(
-        const std::initializer_list<U>&) const noexcept -> bool;
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return operand_.col_size();
+    }
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    [[nodiscard]] constexpr inline auto operator!=(
-        const Matrix<U, A, B>&) const noexcept -> bool;
+    [[nodiscard]] constexpr auto element(std::size_t index) const
+        -> value_type
+    {
+        return static_cast<value_type>(
+            static_cast<value_type>(element_of(operand_, index))
+            * static_cast<value_type>(scalar_));
+    }
 
-    constexpr auto operator[](std::size_t) -> Row<T, I, J>;
+    [[nodiscard]] constexpr auto operand() const noexcept -> const M&
+    {
+        return operand_;
+    }
 
-    constexpr auto operator[](std::size_t) const -> Crow<T, I, J>;
+   private:
+    typename operand_traits<M>::stored_type operand_;
+    S scalar_;
+};
 
-    constexpr auto operator()(std::size_t, std::size_t) const -> T&;
+// The transpose of an operand, read through swapped indices. multiply()
+// consumes the transpose of a matrix directly through its strides.
+template <MatrixOperand M>
+struct transpose_expression {
+    using value_type = operand_value_t<M>;
+    static constexpr std::size_t rows_extent = operand_traits<M>::cols_extent;
+    static constexpr std::size_t cols_extent = operand_traits<M>::rows_extent;
+    static constexpr bool fixed_shape = operand_traits<M>::fixed_shape;
+
+    constexpr explicit transpose_expression(const M& operand)
+        : operand_{ operand }
+    {
+    }
 
-    constexpr auto at(std::size_t, std::size_t) const -> T&;
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return operand_.col_size();
+    }
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    friend constexpr auto operator<<(std::ostream&, const Matrix<U, A, B>&)
-        -> std::ostream&;
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return operand_.row_size();
+    }
 
-    struct iterator {
-       private:
-        Matrix<T, I, J>& matrix;
-        std::size_t row;
-        std::size_t col;
-
-       public:
-        using iterator_category = std::forward_iterator_tag;
-        using value_type = T;
-        using difference_type = std::ptrdiff_t;
-        using pointer = T*;
-        using reference = T&;
-        using const_reference = const T&;
-
-        iterator(Matrix<T, I, J>&, std::size_t, std::size_t) noexcept;
-        auto operator*() noexcept -> reference;
-        auto operator*() const noexcept -> const_reference;
-        auto operator++() noexcept -> iterator&;
-        auto operator++(int) noexcept -> iterator;
-        inline auto operator==(const iterator&) const noexcept -> bool;
-        inline auto operator!=(const iterator&) const noexcept -> bool;
-        friend struct Matrix;
-    };
+    [[nodiscard]] constexpr auto element(std::size_t index) const
+        -> value_type
+    {
+        const auto row = index / operand_.row_size();
+        const auto col = index % operand_.row_size();
+        return element_of(operand_, col * operand_.col_size() + row);
+    }
 
-    struct const_iterator {
-       private:
-        const Matrix<T, I, J>& matrix;
-        std::size_t row;
-        std::size_t col;
-
-       public:
-        using iterator_category = std::forward_iterator_tag;
-        using value_type = T;
-        using difference_type = std::ptrdiff_t;
-        using pointer = T*;
-        using reference = T&;
-        using const_reference = const T&;
-
-        const_iterator(
-            const Matrix<T, I, J>&,
-            std::size_t,
-            std::size_t) noexcept;
-        auto operator*() const noexcept -> const_reference;
-        auto operator++() noexcept -> const_iterator&;
-        auto operator++(int) noexcept -> const_iterator;
-        inline auto operator==(const const_iterator&) const noexcept -> bool;
-        inline auto operator!=(const const_iterator&) const noexcept -> bool;
-        friend struct Matrix;
-    };
+    [[nodiscard]] constexpr auto operand() const noexcept -> const M&
+    {
+        return operand_;
+    }
 
-    auto begin() noexcept -> iterator;
-    auto end() noexcept -> iterator;
+   private:
+    typename operand_traits<M>::stored_type operand_;
+};
 
-    auto begin() const noexcept -> const_iterator;
-    auto end() const noexcept -> const_iterator;
+template <class T>
+struct strided_view {
+    const T* data;
+    std::size_t row_stride;
+    std::size_t col_stride;
 };
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-struct Row {
-   private:
-    Matrix<T, I, J>& matrix;
-    std::vector<T> row;
-    std::size_t n_row;
+template <class T, std::size_t I, std::size_t J>
+constexpr auto strided(const Matrix<T, I, J>& matrix) noexcept
+    -> strided_view<T>
+{
+    return { matrix.data(), matrix.col_size(), 1 };
+}
 
-   public:
-    explicit Row(Matrix<T, I, J>&, std::size_t);
-    ~Row() = default;
-    Row(const Row&) = default;
-    Row(Row&&) noexcept = default;
-    constexpr auto operator=(const Row&) -> Row<T, I, J>& = default;
-    constexpr auto operator=(Row&&) noexcept -> Row<T, I, J>& = default;
-    constexpr auto operator=(const std::vector<T>&) -> Row<T, I, J>&;
+template <class T, std::size_t I, std::size_t J>
+constexpr auto strided(
+    const transpose_expression<Matrix<T, I, J>>& transposed) noexcept
+    -> strided_view<T>
+{
+    return { transposed.operand().data(), 1, transposed.operand().col_size() };
+}
 
-    auto operator[](std::size_t) -> T&;
+// Operands that gemm() can read in place through a row and a column stride.
+template <class M>
+concept StridedOperand = requires(const M& operand) { strided(operand); };
 
-    auto get_row() const -> const std::vector<T>&;
+template <class Op, class Lhs, class Rhs>
+struct is_matrix_expression<binary_expression<Op, Lhs, Rhs>>
+    : std::true_type {};
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    friend auto operator<<(std::ostream&, const Row&) -> std::ostream&;
-};
+template <class M>
+struct is_matrix_expression<transpose_expression<M>> : std::true_type {};
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-struct Crow {
-   private:
-    const Matrix<T, I, J>& matrix;
-    std::vector<T> row;
-    std::size_t n_row;
+template <class M, class S>
+struct is_matrix_expression<scaled_expression<M, S>> : std::true_type {};
 
-   public:
-    explicit Crow(const Matrix<T, I, J>&, std::size_t);
-    ~Crow() = default;
-    Crow(const Crow&) = default;
-    Crow(Crow&&) noexcept = default;
-    constexpr auto operator=(const Crow&) -> Crow<T, I, J>& = default;
-    constexpr auto operator=(Crow&&) noexcept -> Crow<T, I, J>& = default;
+template <class M>
+struct is_transpose_expression : std::false_type {};
+
+template <class M>
+struct is_transpose_expression<transpose_expression<M>> : std::true_type {};
 
-    auto operator[](std::size_t) const -> T;
+// Whether `operand` reads any of the `size` elements starting at `out`.
+template <class T, class M>
+constexpr auto refers_to(const T* out, std::size_t size, const M& operand)
+    -> bool
+{
+    if constexpr (is_matrix_v<M>) {
+        return static_cast<const void*>(operand.data())
+               == static_cast<const void*>(out);
+    }
+    else if constexpr (requires {
+                          operand.lhs();
+                          operand.rhs();
+                      }) {
+        return refers_to(out, size, operand.lhs())
+               or refers_to(out, size, operand.rhs());
+    }
+    else if constexpr (requires { operand.operand(); }) {
+        return refers_to(out, size, operand.operand());
+    }
+    else if constexpr (StridedOperand<M>) {
+        if (operand.row_size() == 0 or operand.col_size() == 0) {
+            return false;
+        }
+        const auto view = strided(operand);
+        const auto* first = static_cast<const void*>(view.data);
+        const auto* last = static_cast<const void*>(
+            view.data + (operand.row_size() - 1) * view.row_stride
+            + (operand.col_size() - 1) * view.col_stride);
+        return std::less<>{}(first, static_cast<const void*>(out + size))
+               and std::less_equal<>{}(static_cast<const void*>(out), last);
+    }
+    else {
+        return false;
+    }
+}
 
-    auto get_row() const -> const std::vector<T>&;
+// Whether writing `source` element by element over the contiguous `size`
+// elements at `out` could overwrite an element before it is read. Matrices
+// and views read at the index being written are safe; a transpose, or a view
+// with other strides, that reads those elements is not.
+template <class T, class M>
+constexpr auto reads_reordered(const T* out, std::size_t size, const M& source)
+    -> bool
+{
+    if constexpr (is_matrix_v<M>) { return false; }
+    else if constexpr (is_transpose_expression<M>::value) {
+        return refers_to(out, size, source.operand());
+    }
+    else if constexpr (requires {
+                          source.lhs();
+                          source.rhs();
+                      }) {
+        return reads_reordered(out, size, source.lhs())
+               or reads_reordered(out, size, source.rhs());
+    }
+    else if constexpr (requires { source.operand(); }) {
+        return reads_reordered(out, size, source.operand());
+    }
+    else if constexpr (StridedOperand<M>) {
+        const auto view = strided(source);
+        const bool in_place =
+            static_cast<const void*>(view.data)
+                == static_cast<const void*>(out)
+            and (view.row_stride == source.col_size() or source.row_size() < 2)
+            and (view.col_stride == 1 or source.col_size() < 2);
+        return not in_place and refers_to(out, size, source);
+    }
+    else {
+        return false;
+    }
+}
 
-    template <detail::Arithmetic U, std::size_t A, std::size_t B>
-    friend auto operator<<(std::ostream&, const Crow&) -> std::ostream&;
-};
-// NOLINTEND(hicpp-named-parameter,readability-named-parameter)
+}  // namespace detail
 
 template <detail::Arithmetic T>
 Matrix(T) -> Matrix<T, 1, 1>;
 
+template <detail::Arithmetic T>
+using DynamicMatrix = Matrix<T, dynamic, dynamic>;
+
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr Matrix<T, I, J>::Matrix() noexcept
 {
@@ -307,8 +2400,42 @@ constexpr Matrix<T, I, J>::Matrix() noexcept
     zeros();
 }
 
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr Matrix<T, I, J>::Matrix(
+    detail::uninitialized_t,
+    std::size_t row_size_,
+    std::size_t col_size_)
+    : rows_{ row_size_ },
+      cols_{ col_size_ },
+      has_been_reallocated{
+          not is_dynamic and (row_size_ != I or col_size_ != J)
+      }
+{
+    if constexpr (has_inline_storage) {
+        if (has_been_reallocated) {
+            throw std::logic_error{ "Matrix::invalid size" };
+        }
+    }
+
+    alloc();
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr Matrix<T, I, J>::Matrix(
+    std::size_t row_size_,
+    std::size_t col_size_,
+    const T& value)
+    requires(is_dynamic)
+    : rows_{ row_size_ }, cols_{ col_size_ }
+{
+    alloc();
+
+    detail::simd::fill(data(), row_size() * col_size(), value);
+}
+
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr Matrix<T, I, J>::~Matrix() noexcept
+    requires(not has_inline_storage)
 {
     dealloc();
 }
@@ -318,12 +2445,17 @@ constexpr Matrix<T, I, J>::Matrix(const T& value) noexcept
 {
     alloc();
 
-    std::fill(begin(), end(), value);
+    detail::simd::fill(data(), row_size() * col_size(), value);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr Matrix<T, I, J>::Matrix(std::initializer_list<T> elems)
 {
+    if constexpr (is_dynamic) {
+        rows_ = elems.size() == 0 ? 0 : 1;
+        cols_ = elems.size();
+    }
+
     alloc();
 
     if (elems.size() != (row_size() * col_size())) [[unlikely]] {
@@ -333,16 +2465,7 @@ constexpr Matrix<T, I, J>::Matrix(std::initializer_list<T> elems)
         };
     }
     else [[likely]] {
-        std::size_t row_num = 0;
-        std::size_t col_num = 0;
-        for (const auto& elem : elems) {
-            data[row_num][col_num] = elem;
-            if (col_num != col_size() - 1) { ++col_num; }
-            else if (row_num != row_size() - 1) {
-                ++row_num;
-                col_num = 0;
-            }
-        }
+        std::copy(elems.begin(), elems.end(), data());
     }
 }
 
@@ -350,6 +2473,11 @@ template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr Matrix<T, I, J>::Matrix(
     std::initializer_list<std::initializer_list<T>> elems)
 {
+    if constexpr (is_dynamic) {
+        rows_ = elems.size();
+        cols_ = elems.size() == 0 ? 0 : elems.begin()->size();
+    }
+
     alloc();
 
     for (const auto& elem : elems) {
@@ -363,17 +2491,9 @@ constexpr Matrix<T, I, J>::Matrix(
         }
     }
 
-    std::size_t i = 0;
-    std::size_t j = 0;
+    auto* dest = data();
     for (const auto& row : elems) {
-        for (const auto& item : row) {
-            data[i][j] = item;
-            if (j != col_size() - 1) { ++j; }
-            else if (i != row_size() - 1) {
-                ++i;
-                j = 0;
-            }
-        }
+        dest = std::copy(row.begin(), row.end(), dest);
     }
 }
 
@@ -387,58 +2507,60 @@ constexpr Matrix<T, I, J>::Matrix(const U& value)
         throw std::logic_error{ "Matrix::Matrix(), inconvertible types" };
     }
 
-    for (auto i = 0; i < row_size(); ++i) {
-        for (auto j = 0; j < col_size(); ++j) {
-            data[i][j] = static_cast<T>(value);
-        }
-    }
+    detail::simd::fill(data(), row_size() * col_size(), static_cast<T>(value));
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr Matrix<T, I, J>::Matrix(const Matrix<T, I, J>& matrix) noexcept
-    : size_{ matrix.size() }, has_been_reallocated{ matrix.is_reallocated() }
+    requires(not has_inline_storage)
+    : rows_{ matrix.row_size() },
+      cols_{ matrix.col_size() },
+      has_been_reallocated{ matrix.is_reallocated() }
 {
     alloc();
 
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][j] = matrix.data[i][j];
-        }
-    }
+    std::copy(matrix.data(), matrix.data() + row_size() * col_size(), data());
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::operator=(
     const Matrix<T, I, J>& matrix) noexcept -> Matrix<T, I, J>&
+    requires(not has_inline_storage)
 {
     if (&matrix != this) {
-        size_ = matrix.size();
+        assign_shape(matrix.row_size(), matrix.col_size());
         has_been_reallocated = matrix.is_reallocated();
 
-        alloc();
-
-        for (std::size_t i = 0; i < row_size(); ++i) {
-            for (std::size_t j = 0; j < col_size(); ++j) {
-                data[i][j] = matrix.data[i][j];
-            }
-        }
+        std::copy(
+            matrix.data(),
+            matrix.data() + row_size() * col_size(),
+            data());
     }
     return *this;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr Matrix<T, I, J>::Matrix(Matrix<T, I, J>&& matrix) noexcept
+    requires(not has_inline_storage)
+    : storage_{ std::exchange(matrix.storage_, {}) },
+      rows_{ std::exchange(matrix.rows_, 0) },
+      cols_{ std::exchange(matrix.cols_, 0) },
+      has_been_reallocated{
+          std::exchange(matrix.has_been_reallocated, false)
+      }
 {
-    *this = std::move(matrix);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::operator=(Matrix<T, I, J>&& matrix) noexcept
     -> Matrix<T, I, J>&
+    requires(not has_inline_storage)
 {
     if (&matrix != this) {
-        data = std::exchange(matrix.data, nullptr);
-        size_ = std::exchange(matrix.size_, { 0, 0 });
+        dealloc();
+        storage_ = std::exchange(matrix.storage_, {});
+        rows_ = std::exchange(matrix.rows_, 0);
+        cols_ = std::exchange(matrix.cols_, 0);
         has_been_reallocated =
             std::exchange(matrix.has_been_reallocated, false);
     }
@@ -447,30 +2569,31 @@ constexpr auto Matrix<T, I, J>::operator=(Matrix<T, I, J>&& matrix) noexcept
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
 constexpr Matrix<T, I, J>::Matrix(const Matrix<U, A, B>& matrix)
 {
     if constexpr (not detail::is_convertible_v<T, U>) {
         throw std::logic_error{ "Matrix::invalid type" };
     }
 
-    if (size() != matrix.size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
-    }
+    if constexpr (not is_dynamic) { detail::check_same_shape(*this, matrix); }
 
-    size_ = matrix.size();
-    has_been_reallocated = matrix.is_reallocated();
+    rows_ = matrix.row_size();
+    cols_ = matrix.col_size();
+    has_been_reallocated = not is_dynamic and matrix.is_reallocated();
 
     alloc();
 
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][j] = static_cast<T>(matrix.underlying_array()[i][j]);
-        }
-    }
+    std::transform(
+        matrix.data(),
+        matrix.data() + row_size() * col_size(),
+        data(),
+        [](const U& elem) { return static_cast<T>(elem); });
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
 constexpr auto Matrix<T, I, J>::operator=(const Matrix<U, A, B>& matrix)
     -> Matrix<T, I, J>&
 {
@@ -478,52 +2601,65 @@ constexpr auto Matrix<T, I, J>::operator=(const Matrix<U, A, B>& matrix)
         throw std::logic_error{ "Matrix::invalid type" };
     }
 
-    if (size() != matrix.size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
-    }
-
-    size_ = matrix.size();
-    has_been_reallocated = matrix.is_reallocated();
+    if constexpr (not is_dynamic) { detail::check_same_shape(*this, matrix); }
 
-    alloc();
+    assign_shape(matrix.row_size(), matrix.col_size());
+    has_been_reallocated = not is_dynamic and matrix.is_reallocated();
 
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][j] = static_cast<T>(matrix.underlying_array()[i][j]);
-        }
-    }
+    std::transform(
+        matrix.data(),
+        matrix.data() + row_size() * col_size(),
+        data(),
+        [](const U& elem) { return static_cast<T>(elem); });
 
     return *this;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 template <detail::Arithmetic U, std::size_t A, std::size_t B>
-constexpr Matrix<T, I, J>::Matrix(Matrix<U, A, B>&& matrix) : size_{ 0, 0 }
+    requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
+constexpr Matrix<T, I, J>::Matrix(Matrix<U, A, B>&& matrix)
 {
-    if constexpr (not detail::is_convertible_v<T, U>) {
-        throw std::logic_error{ "Matrix::invalid type" };
-    }
-
-    if (size() != matrix.size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
-    }
-
     *this = std::move(matrix);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
 constexpr auto Matrix<T, I, J>::operator=(Matrix<U, A, B>&& matrix)
     -> Matrix<T, I, J>&
 {
     if constexpr (not detail::is_convertible_v<T, U>) {
         throw std::logic_error{ "Matrix::invalid type" };
     }
-    else if (size() != matrix.size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
-    }
     else {
-        *this = std::move(matrix);
+        if constexpr (not is_dynamic) {
+            detail::check_same_shape(*this, matrix);
+        }
+
+        // Blocks of the same element type are interchangeable between fixed
+        // and runtime extents, so they are stolen; anything else is copied.
+        if constexpr (
+            std::is_same_v<T, U> and not has_inline_storage
+            and not Matrix<U, A, B>::has_inline_storage) {
+            dealloc();
+            static_cast<detail::heap_storage<T>&>(storage_) =
+                static_cast<detail::heap_storage<T>&>(matrix.storage_);
+            if constexpr (is_dynamic) {
+                storage_.capacity = matrix.row_size() * matrix.col_size();
+                storage_.row_capacity = matrix.row_size();
+            }
+            matrix.storage_ = {};
+
+            rows_ = std::exchange(matrix.rows_, 0);
+            cols_ = std::exchange(matrix.cols_, 0);
+            has_been_reallocated =
+                not is_dynamic
+                and std::exchange(matrix.has_been_reallocated, false);
+        }
+        else {
+            *this = static_cast<const Matrix<U, A, B>&>(matrix);
+        }
 
         return *this;
     }
@@ -544,16 +2680,9 @@ constexpr auto Matrix<T, I, J>::operator=(const std::initializer_list<U>& list)
         };
     }
 
-    std::size_t row_num = 0;
-    std::size_t col_num = 0;
-    for (const auto& elem : list) {
-        data[row_num][col_num] = elem;
-        if (col_num != col_size() - 1) { ++col_num; }
-        else if (row_num != row_size() - 1) {
-            ++row_num;
-            col_num = 0;
-        }
-    }
+    std::transform(list.begin(), list.end(), data(), [](const U& elem) {
+        return static_cast<T>(elem);
+    });
 
     return *this;
 }
@@ -573,15 +2702,67 @@ constexpr auto Matrix<T, I, J>::operator=(std::initializer_list<U>&& list)
         };
     }
 
-    std::size_t row_num = 0;
-    std::size_t col_num = 0;
-    for (const auto& elem : list) {
-        data[row_num][col_num] = std::move(elem);
-        if (col_num != col_size() - 1) { ++col_num; }
-        else if (row_num != row_size() - 1) {
-            ++row_num;
-            col_num = 0;
+    std::transform(list.begin(), list.end(), data(), [](const U& elem) {
+        return static_cast<T>(elem);
+    });
+
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::MatrixExpression E>
+    requires detail::SameShape<Matrix<T, I, J>, E>
+constexpr Matrix<T, I, J>::Matrix(const E& expression)
+    : rows_{ expression.row_size() },
+      cols_{ expression.col_size() },
+      has_been_reallocated{ not is_dynamic
+                            and (expression.row_size() != I
+                                 or expression.col_size() != J) }
+{
+    if constexpr (has_inline_storage) {
+        if (has_been_reallocated) {
+            throw std::logic_error{ "Matrix::invalid size" };
+        }
+    }
+
+    alloc();
+
+    for (std::size_t i = 0; i < row_size() * col_size(); ++i) {
+        data()[i] = static_cast<T>(expression.element(i));
+    }
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::MatrixExpression E>
+    requires detail::SameShape<Matrix<T, I, J>, E>
+constexpr auto Matrix<T, I, J>::operator=(const E& expression)
+    -> Matrix<T, I, J>&
+{
+    if constexpr (not is_dynamic) {
+        detail::check_same_shape(*this, expression);
+    }
+
+    if (detail::reads_reordered(data(), row_size() * col_size(), expression)) {
+        using self_transpose = detail::transpose_expression<Matrix>;
+        if constexpr (std::is_same_v<E, self_transpose>) {
+            if (&expression.operand() == this and row_size() == col_size()) {
+                detail::transpose_square(data(), row_size());
+                return *this;
+            }
         }
+        // The expression reads elements of this matrix out of order, so it
+        // is evaluated aside before any of them is resized or overwritten.
+        return *this = Matrix{ expression };
+    }
+
+    if constexpr (is_dynamic) {
+        resize(expression.row_size(), expression.col_size());
+    }
+
+    detail::check_same_shape(*this, expression);
+
+    for (std::size_t i = 0; i < row_size() * col_size(); ++i) {
+        data()[i] = static_cast<T>(expression.element(i));
     }
 
     return *this;
@@ -589,19 +2770,15 @@ constexpr auto Matrix<T, I, J>::operator=(std::initializer_list<U>&& list)
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires(detail::combined_extent_v<I, J, A, B> != dynamic
+             and A >= I and B >= J)
 inline constexpr Matrix<T, I, J>::operator Matrix<U, A, B>() const
 {
-    if constexpr (A < I or B < J) {
-        throw std::logic_error{ "Matrix::invalid size" };
-    }
-
     Matrix<U, A, B> result;
     for (std::size_t i = 0; i < A; ++i) {
         for (std::size_t j = 0; j < B; ++j) {
-            if (i < I and j < J) { result[i][j] = static_cast<U>(data[i][j]); }
-            else {
-                result[i][j] = U();
-            }
+            result.unchecked(i, j) =
+                i < I and j < J ? static_cast<U>(at(i, j)) : U();
         }
     }
 
@@ -610,95 +2787,195 @@ inline constexpr Matrix<T, I, J>::operator Matrix<U, A, B>() const
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::underlying_array() const noexcept -> T**
+    requires(not has_inline_storage)
+{
+    return storage_.rows;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::data() noexcept -> T*
+{
+    return storage_.data();
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::data() const noexcept -> const T*
+{
+    return storage_.data();
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::span() noexcept -> std::span<T>
+{
+    return { data(), row_size() * col_size() };
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::span() const noexcept -> std::span<const T>
 {
-    return data;
+    return { data(), row_size() * col_size() };
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::insert(const T& element) noexcept
 {
+    detail::simd::fill(data(), row_size() * col_size(), element);
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::sort()
+{
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::transpose() const noexcept -> Matrix<T, J, I>
+{
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::transpose
+    };
+
+    Matrix<T, J, I> result{ detail::uninitialized, col_size(), row_size() };
+    instrumentation::detail::record_temporary(
+        row_size() * col_size() * sizeof(T));
+    detail::transpose_blocked(data(), row_size(), col_size(), result.data());
+    return result;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::transpose_inplace() -> Matrix<T, I, J>&
+    requires(I == J)
+{
+    if (row_size() != col_size()) {
+        throw std::logic_error{ "Matrix::transpose_inplace: invalid size" };
+    }
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::transpose
+    };
+
+    detail::transpose_square(data(), row_size());
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::det() const
+    requires(I == J)
+{
+    return det(execution::seq);
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <execution::Policy P>
+constexpr auto Matrix<T, I, J>::det(const P& policy) const
+    requires(I == J)
+{
+    constexpr auto roundhelper = [](double value, int precision) {
+        constexpr double base = 10.0;
+        double multiplier = std::pow(base, precision);
+        return std::round(value * multiplier) / multiplier;
+    };
+
+    constexpr int precision = 5;
+
+    // The determinant of a triangular matrix is the product of its
+    // diagonal, which saves the O(n^3) elimination.
+    const auto triangular =
+        not(has_inline_storage and I <= 4)
+        and (is_upper_triangular() or is_lower_triangular());
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::det,
+        triangular ? row_size() : 2 * row_size() * row_size() * row_size() / 3
+    };
+
+    if constexpr (has_inline_storage and I <= 4) {
+        const auto at = [this](std::size_t i, std::size_t j) {
+            return static_cast<double>(data()[i * J + j]);
+        };
+        return roundhelper(detail::small_det<I>(at), precision);
+    }
+
+    if (row_size() != col_size()) {
+        throw std::logic_error{ "Matrix::det: invalid size" };
+    }
+
+    if (triangular) {
+        double determinant = 1.0;
+        for (std::size_t i = 0; i < row_size(); ++i) {
+            determinant *= static_cast<double>(data()[i * row_size() + i]);
+        }
+        return roundhelper(determinant, precision);
+    }
+
+    Matrix<double, I, J> temp(*this);
+    double determinant =
+        detail::lu_factor(policy, temp.data(), row_size(), nullptr);
     for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) { data[i][j] = element; }
+        determinant *= temp.data()[i * row_size() + i];
     }
+
+    return roundhelper(determinant, precision);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::sort()
+constexpr auto Matrix<T, I, J>::is_diagonal() const noexcept -> bool
 {
+    return is_lower_triangular() and is_upper_triangular();
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::transpose() const noexcept -> Matrix<T, J, I>
+constexpr auto Matrix<T, I, J>::is_identity() const noexcept -> bool
 {
-    Matrix<T, J, I> result{};
-
-    if (has_been_reallocated) { result.realloc(col_size(), row_size()); }
+    if (not is_diagonal()) { return false; }
 
     for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            result.underlying_array()[j][i] = this->underlying_array()[i][j];
-        }
+        if (data()[i * col_size() + i] != T{ 1 }) { return false; }
     }
 
-    return result;
+    return true;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::det() const
+constexpr auto Matrix<T, I, J>::is_upper_triangular() const noexcept -> bool
 {
-    if (row_size() != col_size()) {
-        throw std::logic_error{ "Matrix::det: invalid size" };
-    }
-
-    double determinant = 1;
-    Matrix<double, I, J> temp(*this);
-
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        std::size_t non_zero_row = i;
-        while (non_zero_row < row_size() && temp[non_zero_row][i] == 0) {
-            ++non_zero_row;
-        }
-
-        if (non_zero_row == row_size()) { return 0.0; }
+    if (row_size() != col_size()) { return false; }
 
-        if (non_zero_row != i) {
-            for (std::size_t j = 0; j < col_size(); ++j) {
-                std::swap(temp[i][j], temp[non_zero_row][j]);
+    for (std::size_t row_num = 1; row_num < row_size(); ++row_num) {
+        for (std::size_t col_num = 0; col_num < row_num; ++col_num) {
+            if (data()[row_num * col_size() + col_num] != T{}) {
+                return false;
             }
-            determinant *= -1;
         }
+    }
 
-        double pivot = temp[i][i];
-        determinant *= pivot;
+    return true;
+}
 
-        for (std::size_t j = 0; j < col_size(); ++j) { temp[i][j] /= pivot; }
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::is_lower_triangular() const noexcept -> bool
+{
+    if (row_size() != col_size()) { return false; }
 
-        for (std::size_t k = i + 1; k < row_size(); ++k) {
-            double factor = temp[k][i];
-            for (std::size_t j = 0; j < col_size(); ++j) {
-                temp[k][j] -= factor * temp[i][j];
+    for (std::size_t row_num = 0; row_num < row_size(); ++row_num) {
+        for (auto col_num = row_num + 1; col_num < col_size(); ++col_num) {
+            if (data()[row_num * col_size() + col_num] != T{}) {
+                return false;
             }
         }
     }
 
-    constexpr auto roundhelper = [](double value, int precision) {
-        constexpr double base = 10.0;
-        double multiplier = std::pow(base, precision);
-        return std::round(value * multiplier) / multiplier;
-    };
-
-    constexpr int precision = 5;
-    return roundhelper(determinant, precision);
+    return true;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::is_diagonal() const noexcept -> bool
+constexpr auto Matrix<T, I, J>::is_symmetric() const noexcept -> bool
 {
     if (row_size() != col_size()) { return false; }
 
-    for (std::size_t row_num = 0; row_num < row_size(); ++row_num) {
-        for (std::size_t col_num = 0; col_num < col_size(); ++col_num) {
-            if (row_num != col_num and data[row_num][col_num] != 0) {
+    for (std::size_t row_num = 1; row_num < row_size(); ++row_num) {
+        for (std::size_t col_num = 0; col_num < row_num; ++col_num) {
+            if (data()[row_num * col_size() + col_num]
+                != data()[col_num * col_size() + row_num]) {
                 return false;
             }
         }
@@ -710,26 +2987,22 @@ constexpr auto Matrix<T, I, J>::is_diagonal() const noexcept -> bool
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::zeros() noexcept
 {
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) { data[i][j] = 1; }
-    }
+    detail::simd::fill(data(), row_size() * col_size(), static_cast<T>(1));
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::alloc() noexcept
 {
-    data = new T*[row_size()];
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        data[i] = new T[col_size()];
+    if constexpr (not has_inline_storage) {
+        storage_.allocate(row_size(), col_size());
     }
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::alloc() const noexcept
 {
-    data = new T*[row_size()];
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        data[i] = new T[col_size()];
+    if constexpr (not has_inline_storage) {
+        storage_.allocate(row_size(), col_size());
     }
 }
 
@@ -738,10 +3011,10 @@ constexpr auto Matrix<T, I, J>::alloc(
     std::size_t row_size_,
     std::size_t col_size_) noexcept
 {
-    data = new T*[row_size_];
-    for (std::size_t i = 0; i < row_size_; ++i) { data[i] = new T[col_size_]; }
+    storage_.allocate(row_size_, col_size_);
 
-    size_ = std::make_pair(row_size_, col_size_);
+    rows_ = row_size_;
+    cols_ = col_size_;
 
     zeros();
 }
@@ -751,8 +3024,7 @@ constexpr auto Matrix<T, I, J>::alloc(
     std::size_t row_size_,
     std::size_t col_size_) const noexcept
 {
-    data = new T*[row_size_];
-    for (std::size_t i = 0; i < row_size_; ++i) { data[i] = new T[col_size_]; }
+    storage_.allocate(row_size_, col_size_);
 
     zeros();
 }
@@ -761,49 +3033,157 @@ template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::realloc(
     std::size_t row_size_,
     std::size_t col_size_) noexcept
+    requires(not has_inline_storage and not is_dynamic)
 {
     dealloc();
 
-    size_ = std::make_pair(row_size_, col_size_);
+    rows_ = row_size_;
+    cols_ = col_size_;
 
     alloc(row_size_, col_size_);
 
     has_been_reallocated = true;
 }
 
+// Keeps the elements of the overlapping top-left block and value-initializes
+// the rest. The buffer is reused whenever the new shape fits its capacity.
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::resize(
+    std::size_t row_size_,
+    std::size_t col_size_)
+    requires is_dynamic
+{
+    const auto kept_rows = std::min(row_size_, rows_);
+    const auto kept_cols = std::min(col_size_, cols_);
+
+    if (storage_.fits(row_size_ * col_size_, row_size_)) {
+        auto* elems = data();
+        if (col_size_ < cols_) {
+            for (std::size_t i = 1; i < kept_rows; ++i) {
+                std::copy_n(
+                    elems + i * cols_,
+                    kept_cols,
+                    elems + i * col_size_);
+            }
+        }
+        else if (col_size_ > cols_) {
+            for (std::size_t i = kept_rows; i-- > 1;) {
+                std::copy_backward(
+                    elems + i * cols_,
+                    elems + i * cols_ + kept_cols,
+                    elems + i * col_size_ + kept_cols);
+            }
+        }
+    }
+    else {
+        auto grown = decltype(storage_)::with_capacity(
+            row_size_ * col_size_,
+            row_size_,
+            storage_.resource);
+        for (std::size_t i = 0; i < kept_rows; ++i) {
+            std::copy_n(
+                data() + i * cols_,
+                kept_cols,
+                grown.data() + i * col_size_);
+        }
+        storage_.deallocate();
+        storage_ = grown;
+    }
+
+    storage_.bind_rows(row_size_, col_size_);
+    rows_ = row_size_;
+    cols_ = col_size_;
+
+    for (std::size_t i = 0; i < rows_; ++i) {
+        const auto first = i < kept_rows ? kept_cols : 0;
+        std::fill(data() + i * cols_ + first, data() + (i + 1) * cols_, T{});
+    }
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::reserve(
+    std::size_t row_size_,
+    std::size_t col_size_)
+    requires is_dynamic
+{
+    const auto count = std::max(row_size_ * col_size_, rows_ * cols_);
+    const auto row_count = std::max(row_size_, rows_);
+    if (storage_.fits(count, row_count)) { return; }
+
+    auto grown = decltype(storage_)::with_capacity(
+        count,
+        row_count,
+        storage_.resource);
+    std::copy_n(data(), rows_ * cols_, grown.data());
+    storage_.deallocate();
+    storage_ = grown;
+    storage_.bind_rows(rows_, cols_);
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::capacity() const noexcept -> std::size_t
+    requires is_dynamic
+{
+    return storage_.capacity;
+}
+
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::dealloc() noexcept
 {
-    for (std::size_t i = 0; i < row_size(); ++i) { delete[] data[i]; }
-    delete[] data;
-    data = nullptr;
+    if constexpr (not has_inline_storage) { storage_.deallocate(); }
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::dealloc() const noexcept
 {
-    for (std::size_t i = 0; i < row_size(); ++i) { delete[] data[i]; }
-    delete[] data;
-    data = nullptr;
+    if constexpr (not has_inline_storage) { storage_.deallocate(); }
+}
+
+// Gives the matrix a rows x cols shape with unspecified contents, keeping the
+// current block when it already holds that many elements.
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::assign_shape(
+    std::size_t row_size_,
+    std::size_t col_size_) noexcept
+{
+    if constexpr (is_dynamic) {
+        rows_ = row_size_;
+        cols_ = col_size_;
+        alloc();
+    }
+    else if constexpr (not has_inline_storage) {
+        if (row_size_ != rows_ or col_size_ != cols_ or data() == nullptr) {
+            dealloc();
+            rows_ = row_size_;
+            cols_ = col_size_;
+            alloc();
+        }
+    }
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::size() const noexcept
     -> std::pair<std::size_t, std::size_t>
 {
-    return size_;
+    return { row_size(), col_size() };
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::row_size() const noexcept -> std::size_t
 {
-    return size_.first;
+    if constexpr (has_inline_storage) { return I; }
+    else {
+        return rows_;
+    }
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::col_size() const noexcept -> std::size_t
 {
-    return size_.second;
+    if constexpr (has_inline_storage) { return J; }
+    else {
+        return cols_;
+    }
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
@@ -815,20 +3195,81 @@ constexpr auto Matrix<T, I, J>::is_reallocated() const noexcept -> bool
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::clear() noexcept
 {
-    std::fill(begin(), end(), 0);
+    detail::simd::fill(data(), row_size() * col_size(), T{});
 }
 
+// Binary exponentiation: O(log power) products, ping-ponging between the
+// result, the running square and one scratch matrix. power(0) is the
+// identity.
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::power(unsigned int power) -> Matrix<T, I, J>
+constexpr auto Matrix<T, I, J>::power(unsigned int power) const
+    -> Matrix<T, I, J>
+    requires(I == J)
 {
-    auto result = *this;
-    for (unsigned int i = 0; i < (power - 1); ++i) { result *= *this; }
+    if constexpr (not has_inline_storage) {
+        if (row_size() != col_size()) {
+            throw std::logic_error{ "Matrix::power: invalid size" };
+        }
+    }
+
+    const auto size = row_size();
+    const auto multiply_into =
+        [size](const Matrix& lhs, const Matrix& rhs, Matrix& out) {
+            if constexpr (has_inline_storage) {
+                detail::fixed_gemm<I, I, I>(lhs.data(), rhs.data(), out.data());
+            }
+            else {
+                detail::gemm(
+                    execution::seq,
+                    size,
+                    size,
+                    size,
+                    accumulator_t<T>{ 1 },
+                    lhs.data(),
+                    size,
+                    1,
+                    rhs.data(),
+                    size,
+                    1,
+                    accumulator_t<T>{},
+                    out.data(),
+                    size);
+            }
+        };
+
+    if (power == 0) {
+        auto identity = *this;
+        identity.clear();
+        for (std::size_t i = 0; i < size; ++i) {
+            identity.data()[i * size + i] = T{ 1 };
+        }
+        return identity;
+    }
+
+    auto base = *this;
+    auto scratch = *this;
+    for (; power % 2 == 0; power /= 2) {
+        multiply_into(base, base, scratch);
+        std::swap(base, scratch);
+    }
+
+    auto result = base;
+    while ((power /= 2) != 0) {
+        multiply_into(base, base, scratch);
+        std::swap(base, scratch);
+
+        if (power % 2 == 1) {
+            multiply_into(result, base, scratch);
+            std::swap(result, scratch);
+        }
+    }
 
     return result;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
 constexpr auto Matrix<T, I, J>::operator+=(const Matrix<U, A, B>& matrix)
     -> Matrix<T, I, J>&
 {
@@ -836,213 +3277,761 @@ constexpr auto Matrix<T, I, J>::operator+=(const Matrix<U, A, B>& matrix)
         throw std::logic_error{ "Matrix::invalid type" };
     }
 
-    if (size() != matrix.size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
+    detail::check_same_shape(*this, matrix);
+
+    if constexpr (detail::is_same_v<T, U>) {
+        detail::simd::add(data(), matrix.data(), row_size() * col_size());
+    }
+    else {
+        const auto* other = matrix.data();
+        for (std::size_t i = 0; i < row_size() * col_size(); ++i) {
+            data()[i] += static_cast<T>(other[i]);
+        }
     }
 
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][j] += static_cast<T>(matrix.underlying_array()[i][j]);
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires detail::SameShape<Matrix<T, I, J>, Matrix<U, A, B>>
+constexpr auto Matrix<T, I, J>::operator-=(const Matrix<U, A, B>& matrix)
+    -> Matrix<T, I, J>&
+{
+    if constexpr (not detail::is_convertible_v<T, U>) {
+        throw std::logic_error{ "Matrix::invalid type" };
+    }
+
+    detail::check_same_shape(*this, matrix);
+
+    if constexpr (detail::is_same_v<T, U>) {
+        detail::simd::sub(data(), matrix.data(), row_size() * col_size());
+    }
+    else {
+        const auto* other = matrix.data();
+        for (std::size_t i = 0; i < row_size() * col_size(); ++i) {
+            data()[i] -= static_cast<T>(other[i]);
+        }
+    }
+
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::MatrixExpression E>
+    requires detail::SameShape<Matrix<T, I, J>, E>
+constexpr auto Matrix<T, I, J>::operator+=(const E& expression)
+    -> Matrix<T, I, J>&
+{
+    detail::check_same_shape(*this, expression);
+
+    if (detail::reads_reordered(data(), row_size() * col_size(), expression)) {
+        return *this += Matrix{ expression };
+    }
+
+    for (std::size_t i = 0; i < row_size() * col_size(); ++i) {
+        data()[i] += static_cast<T>(expression.element(i));
+    }
+
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::MatrixExpression E>
+    requires detail::SameShape<Matrix<T, I, J>, E>
+constexpr auto Matrix<T, I, J>::operator-=(const E& expression)
+    -> Matrix<T, I, J>&
+{
+    detail::check_same_shape(*this, expression);
+
+    if (detail::reads_reordered(data(), row_size() * col_size(), expression)) {
+        return *this -= Matrix{ expression };
+    }
+
+    for (std::size_t i = 0; i < row_size() * col_size(); ++i) {
+        data()[i] -= static_cast<T>(expression.element(i));
+    }
+
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::Arithmetic U, std::size_t A, std::size_t B>
+    requires(detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+             and detail::extents_match_v<J, B>)
+constexpr auto Matrix<T, I, J>::operator*=(const Matrix<U, A, B>& matrix)
+    -> Matrix<T, I, J>&
+{
+    detail::check_multipliable(*this, matrix);
+
+    if constexpr (not detail::is_convertible_v<T, U>) {
+        throw std::logic_error{ "Matrix::invalid type" };
+    }
+
+    // Only runtime-sized matrices change shape; any other matrix, including
+    // a reallocated one, must keep its number of columns.
+    if constexpr (not is_dynamic) {
+        if (matrix.col_size() != col_size()) {
+            throw std::logic_error{ "Matrix::invalid size" };
         }
     }
 
+    const auto result = multiply(*this, matrix);
+    if constexpr (is_dynamic) { resize(result.row_size(), result.col_size()); }
+    std::transform(
+        result.data(),
+        result.data() + result.row_size() * result.col_size(),
+        data(),
+        [](const auto& elem) { return static_cast<T>(elem); });
+
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::Scalar<T> U>
+constexpr auto Matrix<T, I, J>::operator*=(const U& scalar) -> Matrix<T, I, J>&
+{
+    detail::simd::scale(
+        data(),
+        row_size() * col_size(),
+        static_cast<T>(scalar));
+
+    return *this;
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+template <detail::Scalar<T> U>
+constexpr auto Matrix<T, I, J>::operator*=(const std::vector<U>& vector)
+    -> Matrix<T, I, J>&
+{
+    if constexpr (not detail::is_convertible_v<T, U>) {
+        throw std::logic_error{ "Matrix::invalid type" };
+    }
+
+    if (col_size() != vector.size()) {
+        throw std::logic_error{ "Matrix::invalid vector size" };
+    }
+    // The product is a single column, which only a runtime-sized matrix or
+    // a column matrix can hold.
+    if (not is_dynamic and col_size() != 1) {
+        throw std::logic_error{ "Matrix::invalid size" };
+    }
+
+    std::vector<T> product(row_size());
+    detail::gemv(
+        row_size(),
+        col_size(),
+        accumulator_t<T, U>{ 1 },
+        data(),
+        col_size(),
+        std::size_t{ 1 },
+        vector.data(),
+        accumulator_t<T, U>{},
+        product.data());
+
+    if constexpr (is_dynamic) { resize(row_size(), 1); }
+    std::copy(product.begin(), product.end(), data());
+
     return *this;
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-template <detail::Arithmetic U, std::size_t A, std::size_t B>
-constexpr auto Matrix<T, I, J>::operator-=(const Matrix<U, A, B>& matrix)
-    -> Matrix<T, I, J>&
+template <detail::MatrixOperand L, detail::MatrixOperand R>
+    requires detail::SameShape<L, R>
+constexpr auto operator+(const L& lhs, const R& rhs)
+{
+    return detail::binary_expression<detail::plus_op, L, R>{ lhs, rhs };
+}
+
+template <detail::MatrixOperand L, detail::MatrixOperand R>
+    requires detail::SameShape<L, R>
+constexpr auto operator-(const L& lhs, const R& rhs)
+{
+    return detail::binary_expression<detail::minus_op, L, R>{ lhs, rhs };
+}
+
+namespace detail {
+
+template <execution::Policy P, StridedOperand L, StridedOperand R>
+constexpr auto strided_multiply(const P& policy, const L& lhs, const R& rhs)
+    -> operand_product_t<L, R>
+{
+    check_multipliable(lhs, rhs);
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::multiply,
+        2 * lhs.row_size() * rhs.col_size() * lhs.col_size()
+    };
+
+    operand_product_t<L, R> result{
+        uninitialized,
+        lhs.row_size(),
+        rhs.col_size()
+    };
+    instrumentation::detail::record_temporary(
+        result.row_size() * result.col_size()
+        * sizeof(typename operand_product_t<L, R>::value_type));
+
+    using acc_type = accumulator_t<
+        typename operand_product_t<L, R>::value_type,
+        operand_value_t<L>,
+        operand_value_t<R>>;
+    const auto a = strided(lhs);
+    const auto b = strided(rhs);
+    gemm(
+        policy,
+        lhs.row_size(),
+        rhs.col_size(),
+        lhs.col_size(),
+        acc_type{ 1 },
+        a.data,
+        a.row_stride,
+        a.col_stride,
+        b.data,
+        b.row_stride,
+        b.col_stride,
+        acc_type{},
+        result.data(),
+        result.col_size());
+
+    return result;
+}
+
+}  // namespace detail
+
+template <
+    detail::Arithmetic T,
+    detail::Arithmetic U,
+    std::size_t I,
+    std::size_t J,
+    std::size_t A,
+    std::size_t B>
+constexpr auto operator*(const Matrix<T, I, J>& lhs, const Matrix<U, A, B>& rhs)
+    -> detail::product_t<T, U, I, J, A, B>
+    requires detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+{
+    return multiply(lhs, rhs);
+}
+
+template <
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+inline constexpr auto multiply(
+    const Matrix<T, I, J>& lhs,
+    const Matrix<U, A, B>& rhs) -> detail::product_t<T, U, I, J, A, B>
+    requires detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+{
+    return multiply(execution::seq, lhs, rhs);
+}
+
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+inline constexpr auto multiply(
+    const P& policy,
+    const Matrix<T, I, J>& lhs,
+    const Matrix<U, A, B>& rhs) -> detail::product_t<T, U, I, J, A, B>
+    requires detail::Multipliable<Matrix<T, I, J>, Matrix<U, A, B>>
+{
+    if constexpr (Matrix<T, I, J>::has_inline_storage
+                  and Matrix<U, A, B>::has_inline_storage) {
+        const instrumentation::detail::scoped_operation operation{
+            instrumentation::kind::multiply,
+            2 * I * B * J
+        };
+
+        detail::product_t<T, U, I, J, A, B> result;
+        instrumentation::detail::record_temporary(sizeof(result));
+        detail::fixed_gemm<I, B, J>(lhs.data(), rhs.data(), result.data());
+        return result;
+    }
+    else {
+        return detail::strided_multiply(policy, lhs, rhs);
+    }
+}
+
+template <
+    execution::Policy P,
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires(not(detail::is_matrix_v<L> and detail::is_matrix_v<R>)
+             and detail::Multipliable<L, R>)
+constexpr auto multiply(const P& policy, const L& lhs, const R& rhs)
+    -> detail::operand_product_t<L, R>
+{
+    return detail::strided_multiply(policy, lhs, rhs);
+}
+
+template <detail::StridedOperand L, detail::StridedOperand R>
+    requires(not(detail::is_matrix_v<L> and detail::is_matrix_v<R>)
+             and detail::Multipliable<L, R>)
+constexpr auto multiply(const L& lhs, const R& rhs)
+    -> detail::operand_product_t<L, R>
+{
+    return detail::strided_multiply(execution::seq, lhs, rhs);
+}
+
+template <
+    detail::MatrixOperand L,
+    detail::Scalar<detail::operand_value_t<L>> U>
+constexpr auto operator*(const L& lhs, const U& rhs)
+{
+    return detail::scaled_expression<L, U>{ lhs, rhs };
+}
+
+template <
+    detail::MatrixOperand R,
+    detail::Scalar<detail::operand_value_t<R>> U>
+constexpr auto operator*(const U& lhs, const R& rhs)
 {
-    if constexpr (not detail::is_convertible_v<T, U>) {
-        throw std::logic_error{ "Matrix::invalid type" };
-    }
+    return detail::scaled_expression<R, U>{ rhs, lhs };
+}
 
-    if (size() != matrix.size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
+template <detail::MatrixOperand L, detail::MatrixOperand R>
+    requires((detail::MatrixExpression<L> or detail::MatrixExpression<R>)
+             and detail::Multipliable<L, R>)
+constexpr auto operator*(const L& lhs, const R& rhs)
+{
+    if constexpr (detail::StridedOperand<L> and detail::StridedOperand<R>) {
+        return multiply(lhs, rhs);
     }
-
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][j] -= static_cast<T>(matrix.underlying_array()[i][j]);
-        }
+    else {
+        return multiply(detail::evaluate(lhs), detail::evaluate(rhs));
     }
+}
 
-    return *this;
+// Lazy transpose of a matrix or an expression; no elements are moved until it
+// is evaluated, and multiply() reads the transpose of a matrix in place.
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto transposed(const M& operand)
+{
+    return detail::transpose_expression<M>{ operand };
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-template <detail::Arithmetic U, std::size_t A, std::size_t B>
-constexpr auto Matrix<T, I, J>::operator*=(const Matrix<U, A, B>& matrix)
-    -> Matrix<T, I, B>&
+// Evaluates `source`, a matrix or an element-wise expression, into
+// `destination`, splitting the elements across the pool of `policy`.
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::MatrixOperand E>
+constexpr auto assign(
+    const P& policy,
+    Matrix<T, I, J>& destination,
+    const E& source) -> Matrix<T, I, J>&
+    requires detail::SameShape<Matrix<T, I, J>, E>
 {
-    auto temp = *this;
+    detail::check_same_shape(destination, source);
 
-    if (col_size() != matrix.row_size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
+    if (detail::reads_reordered(
+            destination.data(),
+            destination.row_size() * destination.col_size(),
+            source)) {
+        return assign(policy, destination, Matrix<T, I, J>{ source });
     }
 
-    if constexpr (not detail::is_convertible_v<T, U>) {
-        throw std::logic_error{ "Matrix::invalid type" };
-    }
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::assign
+    };
 
-    for (std::size_t i = 0; i < temp.row_size(); ++i) {
-        for (std::size_t j = 0; j < matrix.col_size(); ++j) {
-            auto sum = static_cast<T>(0);
-            for (std::size_t k = 0; k < temp.col_size(); ++k) {
-                sum += temp[i][k] * matrix[k][j];
+    auto* values = destination.data();
+    detail::for_each_chunk(
+        policy,
+        destination.row_size() * destination.col_size(),
+        detail::elementwise_grain,
+        [values, &source](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                values[i] = static_cast<T>(detail::element_of(source, i));
             }
-            data[i][j] = sum;
-        }
-    }
+        });
 
-    return *this;
+    return destination;
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-template <detail::Scalar<T> U>
-constexpr auto Matrix<T, I, J>::operator*=(const U& scalar) -> Matrix<T, I, J>&
+namespace detail {
+
+// Gives the destination of an *_into operation a rows x cols shape. Runtime
+// sized destinations are resized, which reuses their buffer when it is large
+// enough; any other destination must already have that shape.
+template <class T, std::size_t I, std::size_t J>
+constexpr auto prepare_output(
+    Matrix<T, I, J>& out,
+    std::size_t rows,
+    std::size_t cols)
 {
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][j] = data[i][j] * static_cast<T>(scalar);
-        }
+    if (out.row_size() == rows and out.col_size() == cols) { return; }
+    if constexpr (Matrix<T, I, J>::is_dynamic) { out.resize(rows, cols); }
+    else {
+        throw std::logic_error{ "Matrix::invalid size" };
     }
+}
 
-    return *this;
+template <class T, class M>
+constexpr auto shares_elements(const T* out, const M& operand) noexcept
+    -> bool
+{
+    return static_cast<const void*>(strided(operand).data)
+           == static_cast<const void*>(out);
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-template <detail::Scalar<T> U>
-constexpr auto Matrix<T, I, J>::operator*=(const std::vector<U>& vector)
-    -> Matrix<T, I, J>&
+// Type a product into a T result is accumulated in: Acc when one is given,
+// otherwise the accumulator of the element types involved.
+template <class Acc, class... Ts>
+using accumulator_for_t =
+    std::conditional_t<std::is_void_v<Acc>, accumulator_t<Ts...>, Acc>;
+
+template <class Out, class L, class R>
+concept ProductInto =
+    Multipliable<L, R>
+    and extents_match_v<
+        operand_traits<Out>::rows_extent,
+        operand_traits<std::remove_cvref_t<L>>::rows_extent>
+    and extents_match_v<
+        operand_traits<Out>::cols_extent,
+        operand_traits<std::remove_cvref_t<R>>::cols_extent>;
+
+template <
+    class Op,
+    execution::Policy P,
+    class T,
+    std::size_t I,
+    std::size_t J,
+    class L,
+    class R>
+constexpr auto elementwise_into(
+    const P& policy,
+    Matrix<T, I, J>& out,
+    const L& lhs,
+    const R& rhs) -> Matrix<T, I, J>&
 {
-    if constexpr (not detail::is_convertible_v<T, U>) {
-        throw std::logic_error{ "Matrix::invalid type" };
-    }
+    check_same_shape(lhs, rhs);
+    prepare_output(out, lhs.row_size(), lhs.col_size());
+
+    constexpr auto is_plus = is_same_v<Op, plus_op>;
+    if constexpr (is_matrix_v<L> and is_matrix_v<R>
+                  and is_same_v<operand_value_t<L>, T>
+                  and is_same_v<operand_value_t<R>, T>) {
+        const auto* a = lhs.data();
+        const auto* b = rhs.data();
+        auto* c = out.data();
+        // c = a + c is c += a, but c = a - c has to go element by element.
+        if (c == b and c != a) {
+            if constexpr (is_plus) { std::swap(a, b); }
+            else {
+                return mtl::assign(
+                    policy,
+                    out,
+                    binary_expression<Op, L, R>{ lhs, rhs });
+            }
+        }
 
-    if (col_size() != vector.size()) {
-        throw std::logic_error{ "Matrix::invalid vector size" };
+        const instrumentation::detail::scoped_operation operation{
+            instrumentation::kind::assign
+        };
+        for_each_chunk(
+            policy,
+            out.row_size() * out.col_size(),
+            elementwise_grain,
+            [a, b, c](std::size_t begin, std::size_t end) {
+                if (c != a) { std::copy(a + begin, a + end, c + begin); }
+                if constexpr (is_plus) {
+                    simd::add(c + begin, b + begin, end - begin);
+                }
+                else {
+                    simd::sub(c + begin, b + begin, end - begin);
+                }
+            });
+        return out;
+    }
+    else {
+        return mtl::assign(
+            policy,
+            out,
+            binary_expression<Op, L, R>{ lhs, rhs });
     }
+}
 
-    const auto temp = *this;
+}  // namespace detail
 
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        data[i][0] = 0;
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            data[i][0] += temp[i][j] * vector[j];
-        }
+// Computes out = alpha * lhs * rhs + beta * out in place, summing products
+// in Acc (by default mtl::accumulator_t of the element types). out is not
+// read when beta is zero; otherwise it must already have the shape of the
+// product. It must not share elements with either operand.
+template <
+    class Acc = void,
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<Matrix<T, I, J>, L, R>
+constexpr auto gemm(
+    const P& policy,
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& alpha,
+    const L& lhs,
+    const R& rhs,
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& beta,
+    Matrix<T, I, J>& out) -> Matrix<T, I, J>&
+{
+    detail::check_multipliable(lhs, rhs);
+    if (detail::shares_elements(out.data(), lhs)
+        or detail::shares_elements(out.data(), rhs)) {
+        throw std::logic_error{ "Matrix::output aliases an operand" };
+    }
+    if (beta == std::remove_cvref_t<decltype(beta)>{}) {
+        detail::prepare_output(out, lhs.row_size(), rhs.col_size());
+    }
+    else if (out.row_size() != lhs.row_size()
+             or out.col_size() != rhs.col_size()) {
+        throw std::logic_error{ "Matrix::invalid size" };
     }
 
-    return *this;
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::multiply,
+        2 * lhs.row_size() * rhs.col_size() * lhs.col_size()
+    };
+
+    using detail::strided;
+    const auto a = strided(lhs);
+    const auto b = strided(rhs);
+    detail::gemm(
+        policy,
+        lhs.row_size(),
+        rhs.col_size(),
+        lhs.col_size(),
+        alpha,
+        a.data,
+        a.row_stride,
+        a.col_stride,
+        b.data,
+        b.row_stride,
+        b.col_stride,
+        beta,
+        out.data(),
+        out.col_size());
+
+    return out;
 }
 
 template <
+    class Acc = void,
     detail::Arithmetic T,
-    detail::Arithmetic U,
     std::size_t I,
     std::size_t J,
-    std::size_t A,
-    std::size_t B>
-constexpr auto operator+(const Matrix<T, I, J>& lhs, const Matrix<U, A, B>& rhs)
-    -> Matrix<std::common_type_t<T, U>, I, J>
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<Matrix<T, I, J>, L, R>
+constexpr auto gemm(
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& alpha,
+    const L& lhs,
+    const R& rhs,
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& beta,
+    Matrix<T, I, J>& out) -> Matrix<T, I, J>&
 {
-    auto tmp = static_cast<Matrix<std::common_type_t<T, U>, I, J>>(lhs);
-    tmp += rhs;
-    return tmp;
+    return gemm<Acc>(execution::seq, alpha, lhs, rhs, beta, out);
 }
 
+// Writes lhs * rhs into out, which must not share elements with either
+// operand, instead of returning a new matrix.
 template <
+    execution::Policy P,
     detail::Arithmetic T,
-    detail::Arithmetic U,
     std::size_t I,
     std::size_t J,
-    std::size_t A,
-    std::size_t B>
-constexpr auto operator-(const Matrix<T, I, J>& lhs, const Matrix<U, A, B>& rhs)
-    -> Matrix<std::common_type_t<T, U>, I, J>
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<Matrix<T, I, J>, L, R>
+constexpr auto multiply_into(
+    const P& policy,
+    Matrix<T, I, J>& out,
+    const L& lhs,
+    const R& rhs) -> Matrix<T, I, J>&
 {
-    auto tmp = static_cast<Matrix<std::common_type_t<T, U>, I, J>>(lhs);
-    tmp -= rhs;
-    return tmp;
+    if constexpr (Matrix<T, I, J>::has_inline_storage
+                  and detail::is_matrix_v<L> and detail::is_matrix_v<R>
+                  and L::has_inline_storage and R::has_inline_storage) {
+        if (detail::shares_elements(out.data(), lhs)
+            or detail::shares_elements(out.data(), rhs)) {
+            throw std::logic_error{ "Matrix::output aliases an operand" };
+        }
+
+        constexpr auto K = detail::operand_traits<L>::cols_extent;
+        const instrumentation::detail::scoped_operation operation{
+            instrumentation::kind::multiply,
+            2 * I * J * K
+        };
+        detail::fixed_gemm<I, J, K>(lhs.data(), rhs.data(), out.data());
+        return out;
+    }
+    else {
+        using acc_type = detail::accumulator_for_t<
+            void,
+            T,
+            detail::operand_value_t<L>,
+            detail::operand_value_t<R>>;
+        return gemm(policy, acc_type{ 1 }, lhs, rhs, acc_type{}, out);
+    }
 }
 
 template <
     detail::Arithmetic T,
-    detail::Arithmetic U,
     std::size_t I,
     std::size_t J,
-    std::size_t A,
-    std::size_t B>
-constexpr auto operator*(const Matrix<T, I, J>& lhs, const Matrix<U, A, B>& rhs)
-    -> Matrix<std::common_type_t<T, U>, I, B>
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<Matrix<T, I, J>, L, R>
+constexpr auto multiply_into(Matrix<T, I, J>& out, const L& lhs, const R& rhs)
+    -> Matrix<T, I, J>&
 {
-    auto tmp = static_cast<Matrix<std::common_type_t<T, U>, I, J>>(lhs);
-
-    return multiply(tmp, rhs);
+    return multiply_into(execution::seq, out, lhs, rhs);
 }
 
+// Writes the transpose of source into out. A square matrix may be
+// transposed into itself; otherwise the two must not share elements.
 template <
     detail::Arithmetic T,
     std::size_t I,
     std::size_t J,
-    detail::Arithmetic U,
     std::size_t A,
     std::size_t B>
-inline constexpr auto multiply(
-    const Matrix<T, I, J>& lhs,
-    const Matrix<U, A, B>& rhs) -> Matrix<std::common_type_t<T, U>, I, B>
+    requires(detail::extents_match_v<I, B> and detail::extents_match_v<J, A>)
+constexpr auto transpose_into(
+    Matrix<T, I, J>& out,
+    const Matrix<T, A, B>& source) -> Matrix<T, I, J>&
 {
-    if (lhs.col_size() != rhs.row_size()) {
-        throw std::logic_error{ "Matrix::invalid size" };
-    }
-
-    Matrix<std::common_type_t<T, U>, I, B> result;
-
-    if (lhs.is_reallocated() or rhs.is_reallocated()) {
-        result.realloc(lhs.row_size(), rhs.col_size());
-    }
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::transpose
+    };
 
-    for (std::size_t i = 0; i < lhs.row_size(); ++i) {
-        for (std::size_t j = 0; j < rhs.col_size(); ++j) {
-            T sum = 0;
-            for (std::size_t k = 0; k < lhs.col_size(); ++k) {
-                sum += lhs[i][k] * rhs[k][j];
-            }
-            result[i][j] = sum;
+    if (out.data() == source.data()) {
+        if (source.row_size() != source.col_size()) {
+            throw std::logic_error{ "Matrix::output aliases an operand" };
         }
+        detail::transpose_square(out.data(), out.row_size());
+        return out;
     }
 
-    return result;
+    detail::prepare_output(out, source.col_size(), source.row_size());
+    detail::transpose_blocked(
+        source.data(),
+        source.row_size(),
+        source.col_size(),
+        out.data());
+    return out;
 }
 
+// Writes lhs + rhs into out, which may be one of the operands.
 template <
+    execution::Policy P,
     detail::Arithmetic T,
-    detail::Scalar<T> U,
     std::size_t I,
-    std::size_t J>
-constexpr auto operator*(const Matrix<T, I, J>& lhs, const U& rhs)
-    -> Matrix<std::common_type_t<T, U>, I, J>
+    std::size_t J,
+    detail::MatrixOperand L,
+    detail::MatrixOperand R>
+    requires(detail::SameShape<L, R> and detail::SameShape<Matrix<T, I, J>, L>)
+constexpr auto add_into(
+    const P& policy,
+    Matrix<T, I, J>& out,
+    const L& lhs,
+    const R& rhs) -> Matrix<T, I, J>&
+{
+    return detail::elementwise_into<detail::plus_op>(policy, out, lhs, rhs);
+}
+
+template <
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::MatrixOperand L,
+    detail::MatrixOperand R>
+    requires(detail::SameShape<L, R> and detail::SameShape<Matrix<T, I, J>, L>)
+constexpr auto add_into(Matrix<T, I, J>& out, const L& lhs, const R& rhs)
+    -> Matrix<T, I, J>&
+{
+    return add_into(execution::seq, out, lhs, rhs);
+}
+
+// Writes lhs - rhs into out, which may be one of the operands.
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t I,
+    std::size_t J,
+    detail::MatrixOperand L,
+    detail::MatrixOperand R>
+    requires(detail::SameShape<L, R> and detail::SameShape<Matrix<T, I, J>, L>)
+constexpr auto subtract_into(
+    const P& policy,
+    Matrix<T, I, J>& out,
+    const L& lhs,
+    const R& rhs) -> Matrix<T, I, J>&
 {
-    auto tmp = static_cast<Matrix<std::common_type_t<T, U>, I, J>>(lhs);
-    tmp *= rhs;
-    return tmp;
+    return detail::elementwise_into<detail::minus_op>(policy, out, lhs, rhs);
 }
 
 template <
     detail::Arithmetic T,
-    detail::Scalar<T> U,
     std::size_t I,
-    std::size_t J>
-constexpr auto operator*(U lhs, const Matrix<T, I, J>& rhs) -> Matrix<T, I, J>
+    std::size_t J,
+    detail::MatrixOperand L,
+    detail::MatrixOperand R>
+    requires(detail::SameShape<L, R> and detail::SameShape<Matrix<T, I, J>, L>)
+constexpr auto subtract_into(Matrix<T, I, J>& out, const L& lhs, const R& rhs)
+    -> Matrix<T, I, J>&
+{
+    return subtract_into(execution::seq, out, lhs, rhs);
+}
+
+template <detail::MatrixExpression E, detail::MatrixOperand M>
+constexpr auto operator==(const E& lhs, const M& rhs) -> bool
 {
-    const_cast<Matrix<T, I, J>&>(rhs) *= lhs;
-    return rhs;
+    if (lhs.row_size() != rhs.row_size() or lhs.col_size() != rhs.col_size()) {
+        return false;
+    }
+
+    using common_type = std::common_type_t<
+        typename E::value_type,
+        detail::operand_value_t<M>>;
+    for (std::size_t i = 0; i < lhs.row_size() * lhs.col_size(); ++i) {
+        if (static_cast<common_type>(detail::element_of(lhs, i))
+            != static_cast<common_type>(detail::element_of(rhs, i))) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::operator^(const unsigned int& power)
     -> Matrix<T, I, J>&
+    requires(I == J)
 {
     *this = this->power(power);
 
@@ -1059,13 +4048,18 @@ constexpr inline auto Matrix<T, I, J>::operator==(
         return false;
     }
 
-    for (std::size_t i = 0; i < row_size(); ++i) {
-        for (std::size_t j = 0; j < col_size(); ++j) {
-            if (data[i][j] != matrix.underlying_array()[i][j]) { return false; }
-        }
+    if constexpr (detail::is_same_v<T, U>) {
+        return detail::simd::equal(
+            data(),
+            matrix.data(),
+            row_size() * col_size());
+    }
+    else {
+        return std::equal(
+            data(),
+            data() + row_size() * col_size(),
+            matrix.data());
     }
-
-    return true;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
@@ -1078,18 +4072,7 @@ constexpr inline auto Matrix<T, I, J>::operator==(
         return false;
     }
 
-    std::size_t row_num = 0;
-    std::size_t col_num = 0;
-    for (const auto& elem : list) {
-        if (data[row_num][col_num] != elem) { return false; }
-        if (col_num != col_size() - 1) { ++col_num; }
-        else if (row_num != row_size() - 1) {
-            ++row_num;
-            col_num = 0;
-        }
-    }
-
-    return true;
+    return std::equal(list.begin(), list.end(), data());
 }
 
 // clang-format off
@@ -1105,9 +4088,7 @@ constexpr inline auto Matrix<T, I, J>::operator!=(const Matrix<U, A, B>& matrix)
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::operator[](std::size_t row) -> Row<T, I, J>
 {
-    if (row > (row_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid row number" };
-    }
+    detail::check_index(row < row_size(), "Matrix::invalid row number");
     return Row(*this, row);
 }
 
@@ -1115,282 +4096,272 @@ template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Matrix<T, I, J>::operator[](std::size_t row) const
     -> Crow<T, I, J>
 {
-    if (row > (row_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid row number" };
-    }
+    detail::check_index(row < row_size(), "Matrix::invalid row number");
     return Crow(*this, row);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-Row<T, I, J>::Row(Matrix<T, I, J>& matrix, std::size_t n_row)
-    : matrix{ matrix }, n_row{ n_row }
+constexpr Row<T, I, J>::Row(Matrix<T, I, J>& matrix, std::size_t n_row) noexcept
+    : row{ matrix.data() + n_row * matrix.col_size() },
+      n_cols{ matrix.col_size() }
 {
-    for (std::size_t i = 0; i < matrix.col_size(); ++i) {
-        row.emplace_back(matrix(n_row, i));
-    }
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
 constexpr auto Row<T, I, J>::operator=(const std::vector<T>& new_row)
     -> Row<T, I, J>&
 {
-    if (not(row.size() == new_row.size())) {
+    if (not(n_cols == new_row.size())) {
         throw std::invalid_argument{ "Row::invalid size" };
     }
 
-    row = new_row;
-
-    std::size_t col_idx = 0;
-    for (const auto elem : row) {
-        matrix.underlying_array()[n_row][col_idx] = elem;
-        ++col_idx;
-    }
+    std::copy(new_row.begin(), new_row.end(), row);
 
     return *this;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Row<T, I, J>::operator[](std::size_t col) -> T&
+constexpr auto Row<T, I, J>::operator[](std::size_t col) const -> T&
 {
-    if (col > (matrix.col_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid col number" };
-    }
-    return matrix(n_row, col);
+    detail::check_index(col < n_cols, "Matrix::invalid col number");
+    return row[col];
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Row<T, I, J>::get_row() const -> const std::vector<T>&
+constexpr auto Row<T, I, J>::size() const noexcept -> std::size_t
 {
-    return row;
+    return n_cols;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-Crow<T, I, J>::Crow(const Matrix<T, I, J>& matrix, std::size_t n_row)
-    : matrix{ matrix }, n_row{ n_row }
+constexpr auto Row<T, I, J>::data() const noexcept -> T*
 {
-    for (std::size_t i = 0; i < matrix.col_size(); ++i) {
-        row.emplace_back(matrix(n_row, i));
-    }
+    return row;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Crow<T, I, J>::operator[](std::size_t col) const -> T
+constexpr auto Row<T, I, J>::begin() const noexcept -> T*
 {
-    if (col > (matrix.col_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid col number" };
-    }
-    return matrix(n_row, col);
+    return row;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Crow<T, I, J>::get_row() const -> const std::vector<T>&
+constexpr auto Row<T, I, J>::end() const noexcept -> T*
 {
-    return row;
+    return row + n_cols;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::operator()(std::size_t row, std::size_t col)
-    const -> T&
+auto Row<T, I, J>::get_row() const -> std::vector<T>
 {
-    if (row > (row_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid row number" };
-    }
-    if (col > (col_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid col number" };
-    }
-
-    return data[row][col];
+    instrumentation::detail::record_temporary(n_cols * sizeof(T));
+    return { begin(), end() };
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-constexpr auto Matrix<T, I, J>::at(std::size_t row, std::size_t col) const -> T&
+constexpr Crow<T, I, J>::Crow(
+    const Matrix<T, I, J>& matrix,
+    std::size_t n_row) noexcept
+    : row{ matrix.data() + n_row * matrix.col_size() },
+      n_cols{ matrix.col_size() }
 {
-    if (row > (row_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid row number" };
-    }
-    if (col > (col_size() - 1)) {
-        throw std::out_of_range{ "Matrix::invalid col number" };
-    }
-
-    return data[row][col];
 }
 
-template <detail::Arithmetic U, std::size_t A, std::size_t B>
-constexpr auto operator<<(std::ostream& ostream, const Matrix<U, A, B>& matrix)
-    -> std::ostream&
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Crow<T, I, J>::operator[](std::size_t col) const -> const T&
 {
-    for (std::size_t i = 0; i < matrix.size_.first; ++i) {
-        for (std::size_t j = 0; j < matrix.size_.second; ++j) {
-            ostream << matrix.data[i][j] << " ";
-        }
-        ostream << "\n";
-    }
-
-    return ostream;
+    detail::check_index(col < n_cols, "Matrix::invalid col number");
+    return row[col];
 }
 
-template <detail::Arithmetic U, std::size_t A, std::size_t B>
-constexpr auto operator<<(std::ostream& ostream, const Row<U, A, B>& row)
-    -> std::ostream&
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Crow<T, I, J>::size() const noexcept -> std::size_t
 {
-    for (const auto& elem : row.get_row()) {
-        ostream << elem;
-        ostream << " ";
-    }
-
-    return ostream;
+    return n_cols;
 }
 
-template <detail::Arithmetic U, std::size_t A, std::size_t B>
-constexpr auto operator<<(std::ostream& ostream, const Crow<U, A, B>& row)
-    -> std::ostream&
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Crow<T, I, J>::data() const noexcept -> const T*
 {
-    for (const auto& elem : row.get_row()) {
-        ostream << elem;
-        ostream << " ";
-    }
-
-    return ostream;
+    return row;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-Matrix<T, I, J>::iterator::iterator(
-    Matrix<T, I, J>& matrix_,
-    std::size_t row_,
-    std::size_t col_) noexcept
-    : matrix{ matrix_ }, row{ row_ }, col{ col_ }
+constexpr auto Crow<T, I, J>::begin() const noexcept -> const T*
 {
+    return row;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-Matrix<T, I, J>::const_iterator::const_iterator(
-    const Matrix<T, I, J>& matrix_,
-    std::size_t row_,
-    std::size_t col_) noexcept
-    : matrix{ matrix_ }, row{ row_ }, col{ col_ }
+constexpr auto Crow<T, I, J>::end() const noexcept -> const T*
 {
+    return row + n_cols;
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::iterator::operator*() noexcept -> T&
+auto Crow<T, I, J>::get_row() const -> std::vector<T>
 {
-    return matrix.underlying_array()[row][col];
+    instrumentation::detail::record_temporary(n_cols * sizeof(T));
+    return { begin(), end() };
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::iterator::operator*() const noexcept -> const T&
+constexpr auto Matrix<T, I, J>::operator()(std::size_t row, std::size_t col)
+    -> T&
 {
-    return matrix.underlying_array()[row][col];
+    detail::check_index(row < row_size(), "Matrix::invalid row number");
+    detail::check_index(col < col_size(), "Matrix::invalid col number");
+
+    return unchecked(row, col);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::const_iterator::operator*() const noexcept -> const T&
+constexpr auto Matrix<T, I, J>::operator()(std::size_t row, std::size_t col)
+    const -> const T&
 {
-    if (row >= matrix.row_size() or col >= matrix.col_size()) {
-        static T default_value{};
-        return default_value;
-    }
-    return matrix(row, col);
+    detail::check_index(row < row_size(), "Matrix::invalid row number");
+    detail::check_index(col < col_size(), "Matrix::invalid col number");
+
+    return unchecked(row, col);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::iterator::operator++() noexcept
-    -> Matrix<T, I, J>::iterator&
+constexpr auto Matrix<T, I, J>::at(std::size_t row, std::size_t col) -> T&
 {
-    ++col;
-    if (col == matrix.col_size()) [[unlikely]] {
-        col = 0;
-        ++row;
+    if (row >= row_size()) {
+        throw std::out_of_range{ "Matrix::invalid row number" };
+    }
+    if (col >= col_size()) {
+        throw std::out_of_range{ "Matrix::invalid col number" };
     }
 
-    return *this;
+    return unchecked(row, col);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::const_iterator::operator++() noexcept
-    -> Matrix<T, I, J>::const_iterator&
+constexpr auto Matrix<T, I, J>::at(std::size_t row, std::size_t col) const
+    -> const T&
 {
-    ++col;
-    if (col == matrix.col_size()) [[unlikely]] {
-        col = 0;
-        ++row;
+    if (row >= row_size()) {
+        throw std::out_of_range{ "Matrix::invalid row number" };
+    }
+    if (col >= col_size()) {
+        throw std::out_of_range{ "Matrix::invalid col number" };
     }
 
-    return *this;
+    return unchecked(row, col);
+}
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+constexpr auto Matrix<T, I, J>::unchecked(
+    std::size_t row,
+    std::size_t col) noexcept -> T&
+{
+    return data()[row * col_size() + col];
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::iterator::operator++(int) noexcept
-    -> Matrix<T, I, J>::iterator
+constexpr auto Matrix<T, I, J>::unchecked(
+    std::size_t row,
+    std::size_t col) const noexcept -> const T&
 {
-    auto temp = *this;
+    return data()[row * col_size() + col];
+}
 
-    ++(*this);
+namespace detail {
 
-    return temp;
+// Streams have no overloads for low-precision elements; they are printed as
+// the float they convert to.
+template <class T>
+constexpr auto printable(const T& value)
+{
+    if constexpr (is_low_precision_v<T>) { return static_cast<float>(value); }
+    else {
+        return value;
+    }
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::const_iterator::operator++(int) noexcept
-    -> Matrix<T, I, J>::const_iterator
+}  // namespace detail
+
+template <detail::Arithmetic U, std::size_t A, std::size_t B>
+constexpr auto operator<<(std::ostream& ostream, const Matrix<U, A, B>& matrix)
+    -> std::ostream&
 {
-    auto temp = *this;
+    for (std::size_t i = 0; i < matrix.row_size(); ++i) {
+        for (std::size_t j = 0; j < matrix.col_size(); ++j) {
+            const auto& elem = matrix.data()[i * matrix.col_size() + j];
+            ostream << detail::printable(elem) << " ";
+        }
+        ostream << "\n";
+    }
 
-    ++(*this);
+    return ostream;
+}
+
+template <detail::Arithmetic U, std::size_t A, std::size_t B>
+constexpr auto operator<<(std::ostream& ostream, const Row<U, A, B>& row)
+    -> std::ostream&
+{
+    for (const auto& elem : row) {
+        ostream << detail::printable(elem);
+        ostream << " ";
+    }
 
-    return temp;
+    return ostream;
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-inline auto Matrix<T, I, J>::iterator::operator==(
-    const iterator& iter) const noexcept -> bool
+template <detail::Arithmetic U, std::size_t A, std::size_t B>
+constexpr auto operator<<(std::ostream& ostream, const Crow<U, A, B>& row)
+    -> std::ostream&
 {
-    return row == iter.row and col == iter.col;
+    for (const auto& elem : row) {
+        ostream << detail::printable(elem);
+        ostream << " ";
+    }
+
+    return ostream;
 }
 
-template <detail::Arithmetic T, std::size_t I, std::size_t J>
-inline auto Matrix<T, I, J>::const_iterator::operator==(
-    const const_iterator& iter) const noexcept -> bool
+template <detail::MatrixExpression E>
+auto operator<<(std::ostream& ostream, const E& expression) -> std::ostream&
 {
-    return row == iter.row and col == iter.col;
+    return ostream << detail::evaluate(expression);
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::iterator::operator!=(const iterator& iter) const noexcept
-    -> bool
+constexpr auto Matrix<T, I, J>::begin() noexcept -> iterator
 {
-    return not(*this == iter);
+    return data();
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::const_iterator::operator!=(
-    const const_iterator& iter) const noexcept -> bool
+constexpr auto Matrix<T, I, J>::end() noexcept -> iterator
 {
-    return not(*this == iter);
+    return data() + row_size() * col_size();
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::begin() noexcept -> Matrix<T, I, J>::iterator
+constexpr auto Matrix<T, I, J>::begin() const noexcept -> const_iterator
 {
-    return iterator(*this, 0, 0);
+    return data();
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::begin() const noexcept -> Matrix<T, I, J>::const_iterator
+constexpr auto Matrix<T, I, J>::end() const noexcept -> const_iterator
 {
-    return const_iterator(*this, 0, 0);
+    return data() + row_size() * col_size();
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::end() noexcept -> Matrix<T, I, J>::iterator
+constexpr auto Matrix<T, I, J>::cbegin() const noexcept -> const_iterator
 {
-    return iterator(*this, row_size(), 0);
+    return begin();
 }
 
 template <detail::Arithmetic T, std::size_t I, std::size_t J>
-auto Matrix<T, I, J>::end() const noexcept -> Matrix<T, I, J>::const_iterator
+constexpr auto Matrix<T, I, J>::cend() const noexcept -> const_iterator
 {
-    return const_iterator(*this, row_size(), 0);
+    return end();
 }
 
 }  // namespace mtl
@@ -0,0 +1,173 @@
+#ifndef MTL_MEMORY_HPP
+#define MTL_MEMORY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace mtl {
+
+namespace detail {
+
+inline auto resource_slot() noexcept -> std::pmr::memory_resource*&
+{
+    static thread_local std::pmr::memory_resource* resource{
+        std::pmr::new_delete_resource()
+    };
+    return resource;
+}
+
+}  // namespace detail
+
+// Resource that heap-backed matrices created on this thread allocate from.
+// A matrix returns its block to the resource it was allocated from, wherever
+// it is destroyed.
+[[nodiscard]] inline auto current_resource() noexcept
+    -> std::pmr::memory_resource*
+{
+    return detail::resource_slot();
+}
+
+// Makes `resource` the current resource of this thread for its lifetime.
+class scoped_resource final {
+   public:
+    explicit scoped_resource(std::pmr::memory_resource& resource) noexcept
+        : previous_{ std::exchange(detail::resource_slot(), &resource) }
+    {
+    }
+
+    scoped_resource(const scoped_resource&) = delete;
+    auto operator=(const scoped_resource&) -> scoped_resource& = delete;
+
+    ~scoped_resource() { detail::resource_slot() = previous_; }
+
+   private:
+    std::pmr::memory_resource* previous_;
+};
+
+// Bump allocator for short-lived matrices. Allocation advances a pointer
+// through chunks obtained from `upstream`, deallocation does nothing, and
+// reset() rewinds to the first chunk while keeping every chunk for reuse.
+// Not thread safe: give each thread its own arena, e.g. thread_arena().
+class arena final : public std::pmr::memory_resource {
+   public:
+    static constexpr std::size_t default_chunk_size = std::size_t{ 1 } << 20;
+
+    explicit arena(
+        std::size_t chunk_size = default_chunk_size,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : chunk_size_{ std::max<std::size_t>(chunk_size, 1) },
+          upstream_{ upstream }
+    {
+    }
+
+    arena(const arena&) = delete;
+    auto operator=(const arena&) -> arena& = delete;
+
+    ~arena() override { release(); }
+
+    // Makes all memory handed out so far available again. Every matrix
+    // allocated from the arena must be gone by then.
+    auto reset() noexcept -> void
+    {
+        current_ = 0;
+        offset_ = 0;
+        used_ = 0;
+    }
+
+    // Like reset(), and also returns the chunks to the upstream resource.
+    auto release() noexcept -> void
+    {
+        for (const auto& chunk : chunks_) {
+            upstream_->deallocate(chunk.data, chunk.size, chunk_alignment);
+        }
+        chunks_.clear();
+        reset();
+    }
+
+    // Bytes handed out since the last reset().
+    [[nodiscard]] auto used() const noexcept -> std::size_t { return used_; }
+
+    // Bytes held in chunks.
+    [[nodiscard]] auto reserved() const noexcept -> std::size_t
+    {
+        std::size_t total = 0;
+        for (const auto& chunk : chunks_) { total += chunk.size; }
+        return total;
+    }
+
+   private:
+    static constexpr std::size_t chunk_alignment = 64;
+
+    struct chunk {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override
+    {
+        alignment = std::max(alignment, alignof(std::max_align_t));
+
+        for (; current_ < chunks_.size(); ++current_, offset_ = 0) {
+            const auto& chunk = chunks_[current_];
+            const auto aligned = align_up(chunk.data, offset_, alignment);
+            if (aligned + bytes <= chunk.size) {
+                offset_ = aligned + bytes;
+                used_ += bytes;
+                return chunk.data + aligned;
+            }
+        }
+
+        // Nothing left fits: the new chunk goes after the exhausted ones.
+        const auto size = std::max(chunk_size_, bytes + alignment);
+        auto* data = static_cast<std::byte*>(
+            upstream_->allocate(size, chunk_alignment));
+        chunks_.push_back({ data, size });
+        current_ = chunks_.size() - 1;
+
+        const auto aligned = align_up(data, 0, alignment);
+        offset_ = aligned + bytes;
+        used_ += bytes;
+        return data + aligned;
+    }
+
+    auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
+
+    [[nodiscard]] auto do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept
+        -> bool override
+    {
+        return this == &other;
+    }
+
+    [[nodiscard]] static auto align_up(
+        const std::byte* base,
+        std::size_t offset,
+        std::size_t alignment) noexcept -> std::size_t
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(base) + offset;
+        return offset + (alignment - address % alignment) % alignment;
+    }
+
+    std::size_t chunk_size_;
+    std::pmr::memory_resource* upstream_;
+    std::vector<chunk> chunks_;
+    std::size_t current_{ 0 };
+    std::size_t offset_{ 0 };
+    std::size_t used_{ 0 };
+};
+
+// Arena owned by the calling thread, released when the thread exits.
+[[nodiscard]] inline auto thread_arena() -> arena&
+{
+    static thread_local arena instance;
+    return instance;
+}
+
+}  // namespace mtl
+
+#endif  // MTL_MEMORY_HPP
@@ -0,0 +1,147 @@
+#ifndef MTL_PRECISION_HPP
+#define MTL_PRECISION_HPP
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+// Low-precision element types, and the wider types that products of them are
+// accumulated in. Storage stays narrow; kernels widen each element once, as
+// they load it, and narrow each result once, as they store it.
+namespace mtl {
+
+#if defined(__FLT16_MAX__)
+#define MTL_HAS_FLOAT16
+// IEEE binary16, where the compiler provides it.
+using half = _Float16;
+#endif
+
+// The upper half of an IEEE float: float's range with 8 bits of mantissa.
+// Conversions from float round to nearest even; arithmetic is done in float.
+class bfloat16 final {
+   public:
+    constexpr bfloat16() noexcept = default;
+
+    template <class U>
+        requires std::is_arithmetic_v<U>
+    constexpr explicit bfloat16(U value) noexcept
+        : bits_{ round(static_cast<float>(value)) }
+    {
+    }
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+    constexpr operator float() const noexcept
+    {
+        return std::bit_cast<float>(static_cast<std::uint32_t>(bits_) << 16U);
+    }
+
+    [[nodiscard]] static constexpr auto from_bits(std::uint16_t bits) noexcept
+        -> bfloat16
+    {
+        bfloat16 value;
+        value.bits_ = bits;
+        return value;
+    }
+
+    [[nodiscard]] constexpr auto bits() const noexcept -> std::uint16_t
+    {
+        return bits_;
+    }
+
+    constexpr auto operator+=(float other) noexcept -> bfloat16&
+    {
+        return *this = bfloat16{ float{ *this } + other };
+    }
+
+    constexpr auto operator-=(float other) noexcept -> bfloat16&
+    {
+        return *this = bfloat16{ float{ *this } - other };
+    }
+
+    constexpr auto operator*=(float other) noexcept -> bfloat16&
+    {
+        return *this = bfloat16{ float{ *this } * other };
+    }
+
+    constexpr auto operator/=(float other) noexcept -> bfloat16&
+    {
+        return *this = bfloat16{ float{ *this } / other };
+    }
+
+   private:
+    static constexpr auto round(float value) noexcept -> std::uint16_t
+    {
+        const auto bits = std::bit_cast<std::uint32_t>(value);
+        // NaNs keep their sign and stay NaNs once the low half is dropped.
+        if ((bits & 0x7FFF'FFFFU) > 0x7F80'0000U) {
+            return static_cast<std::uint16_t>((bits >> 16U) | 0x40U);
+        }
+        const auto bias = 0x7FFFU + ((bits >> 16U) & 1U);
+        return static_cast<std::uint16_t>((bits + bias) >> 16U);
+    }
+
+    std::uint16_t bits_{ 0 };
+};
+
+// Element types that are not arithmetic to the standard library but can be
+// stored in matrices. Specialize for further types.
+template <class T>
+struct is_low_precision : std::false_type {};
+
+template <>
+struct is_low_precision<bfloat16> : std::true_type {};
+
+#if defined(MTL_HAS_FLOAT16)
+template <>
+struct is_low_precision<half> : std::true_type {};
+#endif
+
+template <class T>
+inline constexpr bool is_low_precision_v = is_low_precision<T>::value;
+
+// Type that sums of products of T are accumulated in. Specialize to trade
+// accuracy for speed, or the other way around.
+template <class T>
+struct accumulator {
+    using type = T;
+};
+
+template <>
+struct accumulator<bfloat16> {
+    using type = float;
+};
+
+#if defined(MTL_HAS_FLOAT16)
+template <>
+struct accumulator<half> {
+    using type = float;
+};
+#endif
+
+template <>
+struct accumulator<std::int8_t> {
+    using type = std::int32_t;
+};
+
+template <>
+struct accumulator<std::uint8_t> {
+    using type = std::uint32_t;
+};
+
+template <>
+struct accumulator<std::int16_t> {
+    using type = std::int32_t;
+};
+
+template <>
+struct accumulator<std::uint16_t> {
+    using type = std::uint32_t;
+};
+
+// Accumulator of a product whose operands and result have the types Ts.
+template <class... Ts>
+using accumulator_t = std::common_type_t<typename accumulator<Ts>::type...>;
+
+}  // namespace mtl
+
+#endif  // MTL_PRECISION_HPP
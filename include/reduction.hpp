@@ -0,0 +1,610 @@
+#ifndef MTL_REDUCTION_HPP
+#define MTL_REDUCTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matrix.hpp"
+#include "vector.hpp"
+#include "view.hpp"
+
+namespace mtl {
+
+namespace detail {
+
+// Reductions cut the elements, in row-major order, into blocks whose size
+// depends only on the shape of the operand, reduce every block with a
+// vectorized kernel and combine the block results pairwise. The rounding is
+// therefore the same for any number of threads, and the error of a sum
+// grows with the logarithm of the number of blocks instead of linearly with
+// the number of elements.
+static inline constexpr std::size_t reduction_block = 4096;
+
+template <class R, class Leaf, class Combine>
+constexpr auto pairwise(
+    std::size_t first,
+    std::size_t last,
+    const Leaf& leaf,
+    const Combine& combine) -> R
+{
+    if (last - first == 1) { return leaf(first); }
+    const auto middle = first + (last - first) / 2;
+    return combine(
+        pairwise<R>(first, middle, leaf, combine),
+        pairwise<R>(middle, last, leaf, combine));
+}
+
+// Combines leaf(0), ..., leaf(blocks - 1), of which there must be at least
+// one, computing the leaves on the pool of `policy`.
+template <class R, execution::Policy P, class Leaf, class Combine>
+constexpr auto reduce_blocks(
+    const P& policy,
+    std::size_t blocks,
+    const Leaf& leaf,
+    const Combine& combine) -> R
+{
+    if constexpr (std::is_same_v<P, execution::sequenced_policy>) {
+        return pairwise<R>(0, blocks, leaf, combine);
+    }
+    else {
+        std::vector<R> partials(blocks);
+        for_each_chunk(
+            policy,
+            blocks,
+            elementwise_grain / reduction_block,
+            [&partials, &leaf](std::size_t begin, std::size_t end) {
+                for (auto block = begin; block < end; ++block) {
+                    partials[block] = leaf(block);
+                }
+            });
+        return pairwise<R>(
+            0,
+            blocks,
+            [&partials](std::size_t block) {
+                return std::move(partials[block]);
+            },
+            combine);
+    }
+}
+
+// Reduces the elements [first, last) of an operand with `cols` columns in
+// row-major order, as one run(row, col, count) per row they touch.
+template <class R, class Run, class Combine>
+constexpr auto reduce_segment(
+    std::size_t cols,
+    std::size_t first,
+    std::size_t last,
+    const Run& run,
+    const Combine& combine) -> R
+{
+    auto row = first / cols;
+    auto col = first % cols;
+    auto count = std::min(cols - col, last - first);
+    auto result = run(row, col, count);
+    for (first += count; first < last; first += count) {
+        ++row;
+        count = std::min(cols, last - first);
+        result = combine(result, run(row, 0, count));
+    }
+    return result;
+}
+
+// Reduces the rows x cols elements of one or more operands of that shape.
+template <class R, execution::Policy P, class Run, class Combine>
+constexpr auto reduce_shape(
+    const P& policy,
+    std::size_t rows,
+    std::size_t cols,
+    const Run& run,
+    const Combine& combine) -> R
+{
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::reduce
+    };
+
+    const auto count = rows * cols;
+    return reduce_blocks<R>(
+        policy,
+        (count + reduction_block - 1) / reduction_block,
+        [cols, count, &run, &combine](std::size_t block) {
+            return reduce_segment<R>(
+                cols,
+                block * reduction_block,
+                std::min(count, (block + 1) * reduction_block),
+                run,
+                combine);
+        },
+        combine);
+}
+
+// The elements of a matrix, view or transposed matrix, read in place.
+// Expressions are evaluated first.
+template <MatrixOperand M>
+constexpr auto view_elements(const M& operand) -> MatrixView<operand_value_t<M>>
+{
+    const auto elements = strided(operand);
+    return { elements.data,
+             operand.row_size(),
+             operand.col_size(),
+             elements.row_stride,
+             elements.col_stride };
+}
+
+// The same elements in an order that gives long runs with unit stride:
+// a contiguous view becomes one row, and a view whose columns are
+// contiguous is transposed. Only for reductions that do not depend on the
+// order of the elements.
+template <class T>
+constexpr auto unit_stride_order(MatrixView<T> view) noexcept -> MatrixView<T>
+{
+    if (view.col_size() == 1
+        or (view.col_stride() != 1 and view.row_stride() == 1)) {
+        view = view.transposed();
+    }
+    if (view.is_contiguous()) {
+        return { view.data(), 1, view.row_size() * view.col_size() };
+    }
+    return view;
+}
+
+template <simd::reduction R, execution::Policy P, class T>
+constexpr auto reduce_view(const P& policy, MatrixView<T> view)
+    -> simd::reduction_t<R, T>
+{
+    using result_type = simd::reduction_t<R, T>;
+
+    view = unit_stride_order(view);
+    const auto run = [view](std::size_t row, std::size_t col, std::size_t n) {
+        const auto* elems = &view.unchecked(row, col);
+        return view.col_stride() == 1
+                   ? simd::reduce<R>(elems, n)
+                   : simd::reduce_strided<R>(elems, n, view.col_stride());
+    };
+    const auto combine = [](result_type lhs, result_type rhs) {
+        if constexpr (R == simd::reduction::min) {
+            return std::min(lhs, rhs);
+        }
+        else if constexpr (R == simd::reduction::max) {
+            return std::max(lhs, rhs);
+        }
+        else {
+            return static_cast<result_type>(lhs + rhs);
+        }
+    };
+    return reduce_shape<result_type>(
+        policy,
+        view.row_size(),
+        view.col_size(),
+        run,
+        combine);
+}
+
+template <simd::reduction R, execution::Policy P, MatrixOperand M>
+constexpr auto reduce(const P& policy, const M& operand)
+{
+    if constexpr (StridedOperand<M>) {
+        if (operand.row_size() == 0 or operand.col_size() == 0) {
+            if constexpr (R == simd::reduction::min
+                          or R == simd::reduction::max) {
+                throw std::logic_error{ "Matrix::empty operand" };
+            }
+            else {
+                return simd::reduction_t<R, operand_value_t<M>>{};
+            }
+        }
+        return reduce_view<R>(policy, view_elements(operand));
+    }
+    else {
+        return reduce<R>(policy, evaluate(operand));
+    }
+}
+
+template <class T>
+using norm_t = std::conditional_t<
+    std::is_floating_point_v<accumulator_t<T>>,
+    accumulator_t<T>,
+    double>;
+
+template <class L, class R>
+using dot_t = accumulator_t<operand_value_t<L>, operand_value_t<R>>;
+
+template <class Acc, class Tl, class Tr>
+constexpr auto dot_run(
+    const Tl* lhs,
+    std::size_t lhs_stride,
+    const Tr* rhs,
+    std::size_t rhs_stride,
+    std::size_t count) -> Acc
+{
+    if constexpr (is_same_v<Tl, Tr> and is_same_v<Acc, Tl>) {
+        if (lhs_stride == 1 and rhs_stride == 1) {
+            return simd::dot(lhs, rhs, count);
+        }
+    }
+    else if constexpr (
+        is_same_v<Tl, Tr> and simd::Widenable<Tl> and is_same_v<Acc, float>) {
+        if (lhs_stride == 1 and rhs_stride == 1) {
+            return simd::widening_dot(lhs, rhs, count);
+        }
+    }
+
+    Acc sum{};
+    for (std::size_t i = 0; i < count; ++i) {
+        sum = static_cast<Acc>(
+            sum
+            + static_cast<Acc>(lhs[i * lhs_stride])
+                  * static_cast<Acc>(rhs[i * rhs_stride]));
+    }
+    return sum;
+}
+
+}  // namespace detail
+
+// Sum of the elements, accumulated in mtl::accumulator_t of the element
+// type. Like the other reductions it accepts matrices, views and
+// expressions, and gives the same result for every execution policy.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto sum(const P& policy, const M& operand)
+    -> accumulator_t<detail::operand_value_t<M>>
+{
+    return detail::reduce<detail::simd::reduction::sum>(policy, operand);
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto sum(const M& operand)
+    -> accumulator_t<detail::operand_value_t<M>>
+{
+    return sum(execution::seq, operand);
+}
+
+// Sum of the diagonal of a square operand.
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto trace(const M& operand)
+    -> accumulator_t<detail::operand_value_t<M>>
+{
+    if constexpr (detail::StridedOperand<M>) {
+        if (operand.row_size() != operand.col_size()) {
+            throw std::logic_error{ "Matrix::invalid size" };
+        }
+        const auto elements = detail::view_elements(operand);
+        return sum(MatrixView<detail::operand_value_t<M>>{
+            elements.data(),
+            1,
+            elements.row_size(),
+            0,
+            elements.row_stride() + elements.col_stride() });
+    }
+    else {
+        return trace(detail::evaluate(operand));
+    }
+}
+
+// Frobenius norm: the square root of the sum of the squared elements.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] auto norm_fro(const P& policy, const M& operand)
+    -> detail::norm_t<detail::operand_value_t<M>>
+{
+    using result_type = detail::norm_t<detail::operand_value_t<M>>;
+    return std::sqrt(static_cast<result_type>(
+        detail::reduce<detail::simd::reduction::sum_squares>(
+            policy,
+            operand)));
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] auto norm_fro(const M& operand)
+    -> detail::norm_t<detail::operand_value_t<M>>
+{
+    return norm_fro(execution::seq, operand);
+}
+
+// Infinity norm: the largest sum of absolute values of a row.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto norm_inf(const P& policy, const M& operand)
+    -> accumulator_t<detail::operand_value_t<M>>
+{
+    using result_type = accumulator_t<detail::operand_value_t<M>>;
+    if constexpr (detail::StridedOperand<M>) {
+        const auto elements = detail::view_elements(operand);
+        std::vector<result_type> rows(elements.row_size());
+        detail::for_each_chunk(
+            policy,
+            rows.size(),
+            std::max<std::size_t>(
+                1,
+                detail::elementwise_grain
+                    / std::max<std::size_t>(elements.col_size(), 1)),
+            [&rows, elements](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    rows[i] = detail::reduce<detail::simd::reduction::sum_abs>(
+                        execution::seq,
+                        elements.row(i));
+                }
+            });
+        return rows.empty() ? result_type{} : *std::ranges::max_element(rows);
+    }
+    else {
+        return norm_inf(policy, detail::evaluate(operand));
+    }
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto norm_inf(const M& operand)
+    -> accumulator_t<detail::operand_value_t<M>>
+{
+    return norm_inf(execution::seq, operand);
+}
+
+// Smallest and largest elements; NaNs give unspecified results, and an
+// empty operand throws std::logic_error.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto min(const P& policy, const M& operand)
+    -> detail::operand_value_t<M>
+{
+    return detail::reduce<detail::simd::reduction::min>(policy, operand);
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto min(const M& operand)
+    -> detail::operand_value_t<M>
+{
+    return min(execution::seq, operand);
+}
+
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto max(const P& policy, const M& operand)
+    -> detail::operand_value_t<M>
+{
+    return detail::reduce<detail::simd::reduction::max>(policy, operand);
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto max(const M& operand)
+    -> detail::operand_value_t<M>
+{
+    return max(execution::seq, operand);
+}
+
+// (row, col) of the first largest or smallest element in row-major order.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto argmax(const P& policy, const M& operand)
+    -> std::pair<std::size_t, std::size_t>
+{
+    const auto& elements = detail::evaluate(operand);
+    const auto largest = max(policy, elements);
+    for (std::size_t i = 0; i < elements.row_size(); ++i) {
+        for (std::size_t j = 0; j < elements.col_size(); ++j) {
+            if (not(elements.unchecked(i, j) < largest)) { return { i, j }; }
+        }
+    }
+    return { 0, 0 };
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto argmax(const M& operand)
+    -> std::pair<std::size_t, std::size_t>
+{
+    return argmax(execution::seq, operand);
+}
+
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto argmin(const P& policy, const M& operand)
+    -> std::pair<std::size_t, std::size_t>
+{
+    const auto& elements = detail::evaluate(operand);
+    const auto smallest = min(policy, elements);
+    for (std::size_t i = 0; i < elements.row_size(); ++i) {
+        for (std::size_t j = 0; j < elements.col_size(); ++j) {
+            if (not(smallest < elements.unchecked(i, j))) { return { i, j }; }
+        }
+    }
+    return { 0, 0 };
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto argmin(const M& operand)
+    -> std::pair<std::size_t, std::size_t>
+{
+    return argmin(execution::seq, operand);
+}
+
+// Sum of every row, as a vector with one element per row.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto row_sums(const P& policy, const M& operand)
+    -> Vector<
+        accumulator_t<detail::operand_value_t<M>>,
+        detail::operand_traits<M>::rows_extent>
+{
+    using result_type = Vector<
+        accumulator_t<detail::operand_value_t<M>>,
+        detail::operand_traits<M>::rows_extent>;
+    if constexpr (detail::StridedOperand<M>) {
+        const auto elements = detail::view_elements(operand);
+        result_type result;
+        if constexpr (result_type::is_dynamic) {
+            result.resize(elements.row_size());
+        }
+        detail::for_each_chunk(
+            policy,
+            elements.row_size(),
+            std::max<std::size_t>(
+                1,
+                detail::elementwise_grain
+                    / std::max<std::size_t>(elements.col_size(), 1)),
+            [&result, elements](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    result[i] = sum(elements.row(i));
+                }
+            });
+        return result;
+    }
+    else {
+        return row_sums(policy, detail::evaluate(operand));
+    }
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto row_sums(const M& operand)
+{
+    return row_sums(execution::seq, operand);
+}
+
+// Sum of every column, as a vector with one element per column. Blocks of
+// rows are added up with vector adds and the block results pairwise.
+template <execution::Policy P, detail::MatrixOperand M>
+[[nodiscard]] constexpr auto col_sums(const P& policy, const M& operand)
+    -> Vector<
+        accumulator_t<detail::operand_value_t<M>>,
+        detail::operand_traits<M>::cols_extent>
+{
+    using value_type = detail::operand_value_t<M>;
+    using acc_type = accumulator_t<value_type>;
+    using result_type =
+        Vector<acc_type, detail::operand_traits<M>::cols_extent>;
+    if constexpr (detail::StridedOperand<M>) {
+        const auto elements = detail::view_elements(operand);
+        const auto cols = elements.col_size();
+        if (elements.row_size() == 0) {
+            result_type result;
+            if constexpr (result_type::is_dynamic) { result.resize(cols); }
+            return result;
+        }
+
+        const instrumentation::detail::scoped_operation operation{
+            instrumentation::kind::reduce
+        };
+
+        const auto block_rows = std::max<std::size_t>(
+            1,
+            detail::reduction_block / std::max<std::size_t>(cols, 1));
+        const auto blocks = (elements.row_size() + block_rows - 1) / block_rows;
+        const auto sums = detail::reduce_blocks<std::vector<acc_type>>(
+            policy,
+            blocks,
+            [&](std::size_t block) {
+                std::vector<acc_type> partial(cols);
+                const auto last =
+                    std::min(elements.row_size(), (block + 1) * block_rows);
+                for (auto i = block * block_rows; i < last; ++i) {
+                    const auto* row = &elements.unchecked(i, 0);
+                    if constexpr (detail::is_same_v<acc_type, value_type>) {
+                        if (elements.col_stride() == 1) {
+                            detail::simd::add(partial.data(), row, cols);
+                            continue;
+                        }
+                    }
+                    for (std::size_t j = 0; j < cols; ++j) {
+                        partial[j] = static_cast<acc_type>(
+                            partial[j]
+                            + static_cast<acc_type>(
+                                row[j * elements.col_stride()]));
+                    }
+                }
+                return partial;
+            },
+            [](std::vector<acc_type> lhs, const std::vector<acc_type>& rhs) {
+                detail::simd::add(lhs.data(), rhs.data(), lhs.size());
+                return lhs;
+            });
+        return result_type{ std::span<const acc_type>{ sums } };
+    }
+    else {
+        return col_sums(policy, detail::evaluate(operand));
+    }
+}
+
+template <detail::MatrixOperand M>
+[[nodiscard]] constexpr auto col_sums(const M& operand)
+{
+    return col_sums(execution::seq, operand);
+}
+
+// Sum of the products of corresponding elements of two operands of the same
+// shape (the Frobenius inner product), accumulated in mtl::accumulator_t.
+template <
+    execution::Policy P,
+    detail::MatrixOperand L,
+    detail::MatrixOperand R>
+    requires detail::SameShape<L, R>
+[[nodiscard]] constexpr auto dot(const P& policy, const L& lhs, const R& rhs)
+    -> detail::dot_t<L, R>
+{
+    using result_type = detail::dot_t<L, R>;
+    if constexpr (detail::StridedOperand<L> and detail::StridedOperand<R>) {
+        detail::check_same_shape(lhs, rhs);
+        if (lhs.row_size() == 0 or lhs.col_size() == 0) {
+            return result_type{};
+        }
+
+        auto a = detail::view_elements(lhs);
+        auto b = detail::view_elements(rhs);
+        if (a.is_contiguous() and b.is_contiguous()) {
+            a = { a.data(), 1, a.row_size() * a.col_size() };
+            b = { b.data(), 1, b.row_size() * b.col_size() };
+        }
+        return detail::reduce_shape<result_type>(
+            policy,
+            a.row_size(),
+            a.col_size(),
+            [a, b](std::size_t row, std::size_t col, std::size_t count) {
+                return detail::dot_run<result_type>(
+                    &a.unchecked(row, col),
+                    a.col_stride(),
+                    &b.unchecked(row, col),
+                    b.col_stride(),
+                    count);
+            },
+            [](result_type x, result_type y) {
+                return static_cast<result_type>(x + y);
+            });
+    }
+    else {
+        return dot(policy, detail::evaluate(lhs), detail::evaluate(rhs));
+    }
+}
+
+template <detail::MatrixOperand L, detail::MatrixOperand R>
+    requires detail::SameShape<L, R>
+[[nodiscard]] constexpr auto dot(const L& lhs, const R& rhs)
+    -> detail::dot_t<L, R>
+{
+    return dot(execution::seq, lhs, rhs);
+}
+
+// Dot product of two vectors or other contiguous ranges of the same size.
+template <
+    execution::Policy P,
+    std::ranges::contiguous_range X,
+    std::ranges::contiguous_range Y>
+    requires(not detail::MatrixOperand<X> and not detail::MatrixOperand<Y>)
+[[nodiscard]] constexpr auto dot(const P& policy, const X& x, const Y& y)
+{
+    if (std::ranges::size(x) != std::ranges::size(y)) {
+        throw std::logic_error{ "Vector::invalid size" };
+    }
+    using value_type = std::ranges::range_value_t<X>;
+    using other_type = std::ranges::range_value_t<Y>;
+    return dot(
+        policy,
+        MatrixView<value_type>{ std::ranges::data(x), 1, std::ranges::size(x) },
+        MatrixView<other_type>{ std::ranges::data(y),
+                                1,
+                                std::ranges::size(y) });
+}
+
+template <std::ranges::contiguous_range X, std::ranges::contiguous_range Y>
+    requires(not detail::MatrixOperand<X> and not detail::MatrixOperand<Y>)
+[[nodiscard]] constexpr auto dot(const X& x, const Y& y)
+{
+    return dot(execution::seq, x, y);
+}
+
+}  // namespace mtl
+
+#endif  // MTL_REDUCTION_HPP
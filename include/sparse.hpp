@@ -0,0 +1,477 @@
+#ifndef MTL_SPARSE_HPP
+#define MTL_SPARSE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matrix.hpp"
+
+namespace mtl {
+
+enum class sparse_format { csr, csc };
+
+template <class T>
+struct triplet {
+    std::size_t row;
+    std::size_t col;
+    T value;
+};
+
+// Compressed sparse matrix. In CSR the outer dimension is the rows and the
+// inner indices are column numbers; CSC is the same layout with the roles
+// swapped, which makes the CSR arrays of A the CSC arrays of A^T. Memory is
+// proportional to the number of stored elements.
+template <detail::Arithmetic T, sparse_format Format = sparse_format::csr>
+class SparseMatrix final {
+   public:
+    using value_type = T;
+    static constexpr sparse_format format = Format;
+
+    SparseMatrix() = default;
+
+    // Duplicate coordinates are summed.
+    SparseMatrix(
+        std::size_t rows,
+        std::size_t cols,
+        std::span<const triplet<T>> triplets);
+
+    SparseMatrix(
+        std::size_t rows,
+        std::size_t cols,
+        std::initializer_list<triplet<T>> triplets)
+        : SparseMatrix(
+              rows,
+              cols,
+              std::span<const triplet<T>>{ triplets.begin(), triplets.size() })
+    {
+    }
+
+    template <detail::Arithmetic U, std::size_t I, std::size_t J>
+    explicit SparseMatrix(const Matrix<U, I, J>&);
+
+    template <detail::Arithmetic U, sparse_format F>
+        requires(F != Format or not std::is_same_v<T, U>)
+    explicit SparseMatrix(const SparseMatrix<U, F>&);
+
+    [[nodiscard]] auto row_size() const noexcept -> std::size_t
+    {
+        return rows_;
+    }
+
+    [[nodiscard]] auto col_size() const noexcept -> std::size_t
+    {
+        return cols_;
+    }
+
+    [[nodiscard]] auto size() const noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+        return { rows_, cols_ };
+    }
+
+    [[nodiscard]] auto nnz() const noexcept -> std::size_t
+    {
+        return values_.size();
+    }
+
+    [[nodiscard]] auto outer_size() const noexcept -> std::size_t
+    {
+        return Format == sparse_format::csr ? rows_ : cols_;
+    }
+
+    // outer_starts()[k] .. outer_starts()[k + 1] delimit row (CSR) or column
+    // (CSC) k in inner_indices() and values().
+    [[nodiscard]] auto outer_starts() const noexcept
+        -> std::span<const std::size_t>
+    {
+        return starts_;
+    }
+
+    [[nodiscard]] auto inner_indices() const noexcept
+        -> std::span<const std::size_t>
+    {
+        return indices_;
+    }
+
+    [[nodiscard]] auto values() const noexcept -> std::span<const T>
+    {
+        return values_;
+    }
+
+    [[nodiscard]] auto values() noexcept -> std::span<T> { return values_; }
+
+    // Element (row, col), zero when not stored.
+    [[nodiscard]] auto at(std::size_t, std::size_t) const -> T;
+
+    [[nodiscard]] auto to_dense() const -> DynamicMatrix<T>;
+
+    // Reinterprets the compressed arrays in the opposite format, so the
+    // transpose costs a copy of the arrays and no reordering.
+    [[nodiscard]] auto transpose() const -> SparseMatrix<
+        T,
+        Format == sparse_format::csr ? sparse_format::csc : sparse_format::csr>;
+
+    [[nodiscard]] auto is_diagonal() const noexcept -> bool;
+
+   private:
+    template <detail::Arithmetic U, sparse_format F>
+    friend class SparseMatrix;
+
+    [[nodiscard]] static constexpr auto outer_of(
+        std::size_t row,
+        std::size_t col) noexcept -> std::size_t
+    {
+        return Format == sparse_format::csr ? row : col;
+    }
+
+    [[nodiscard]] static constexpr auto inner_of(
+        std::size_t row,
+        std::size_t col) noexcept -> std::size_t
+    {
+        return Format == sparse_format::csr ? col : row;
+    }
+
+    auto assign(std::span<const triplet<T>>) -> void;
+
+    std::size_t rows_{ 0 };
+    std::size_t cols_{ 0 };
+    std::vector<std::size_t> starts_{ 0 };
+    std::vector<std::size_t> indices_;
+    std::vector<T> values_;
+};
+
+template <detail::Arithmetic T>
+using CsrMatrix = SparseMatrix<T, sparse_format::csr>;
+
+template <detail::Arithmetic T>
+using CscMatrix = SparseMatrix<T, sparse_format::csc>;
+
+template <detail::Arithmetic T, sparse_format Format>
+SparseMatrix<T, Format>::SparseMatrix(
+    std::size_t rows,
+    std::size_t cols,
+    std::span<const triplet<T>> triplets)
+    : rows_{ rows }, cols_{ cols }
+{
+    assign(triplets);
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+auto SparseMatrix<T, Format>::assign(std::span<const triplet<T>> triplets)
+    -> void
+{
+    for (const auto& elem : triplets) {
+        if (elem.row >= rows_ or elem.col >= cols_) {
+            throw std::out_of_range{ "SparseMatrix: triplet out of range" };
+        }
+    }
+
+    // Bucket the triplets by outer index, then sort and merge every bucket.
+    starts_.assign(outer_size() + 1, 0);
+    for (const auto& elem : triplets) {
+        ++starts_[outer_of(elem.row, elem.col) + 1];
+    }
+    for (std::size_t k = 0; k < outer_size(); ++k) {
+        starts_[k + 1] += starts_[k];
+    }
+
+    std::vector<std::pair<std::size_t, T>> entries(triplets.size());
+    auto next = starts_;
+    for (const auto& elem : triplets) {
+        entries[next[outer_of(elem.row, elem.col)]++] = {
+            inner_of(elem.row, elem.col),
+            elem.value
+        };
+    }
+
+    indices_.clear();
+    values_.clear();
+    indices_.reserve(entries.size());
+    values_.reserve(entries.size());
+
+    std::size_t first = 0;
+    for (std::size_t k = 0; k < outer_size(); ++k) {
+        const auto last = starts_[k + 1];
+        std::sort(
+            entries.begin() + static_cast<std::ptrdiff_t>(first),
+            entries.begin() + static_cast<std::ptrdiff_t>(last),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+
+        starts_[k] = indices_.size();
+        for (auto i = first; i < last; ++i) {
+            if (i > first and entries[i].first == indices_.back()) {
+                values_.back() += entries[i].second;
+            }
+            else {
+                indices_.push_back(entries[i].first);
+                values_.push_back(entries[i].second);
+            }
+        }
+        first = last;
+    }
+    starts_[outer_size()] = indices_.size();
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+template <detail::Arithmetic U, std::size_t I, std::size_t J>
+SparseMatrix<T, Format>::SparseMatrix(const Matrix<U, I, J>& matrix)
+    : rows_{ matrix.row_size() }, cols_{ matrix.col_size() }
+{
+    starts_.assign(outer_size() + 1, 0);
+    for (std::size_t k = 0; k < outer_size(); ++k) {
+        const auto inner_size = Format == sparse_format::csr ? cols_ : rows_;
+        for (std::size_t i = 0; i < inner_size; ++i) {
+            const auto row = Format == sparse_format::csr ? k : i;
+            const auto col = Format == sparse_format::csr ? i : k;
+            const auto elem = matrix.data()[row * cols_ + col];
+            if (elem != U{}) {
+                indices_.push_back(i);
+                values_.push_back(static_cast<T>(elem));
+            }
+        }
+        starts_[k + 1] = indices_.size();
+    }
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+template <detail::Arithmetic U, sparse_format F>
+    requires(F != Format or not std::is_same_v<T, U>)
+SparseMatrix<T, Format>::SparseMatrix(const SparseMatrix<U, F>& matrix)
+    : rows_{ matrix.rows_ }, cols_{ matrix.cols_ }
+{
+    if constexpr (F == Format) {
+        starts_ = matrix.starts_;
+        indices_ = matrix.indices_;
+        values_.assign(matrix.values_.begin(), matrix.values_.end());
+        return;
+    }
+
+    // Counting sort of the stored elements by their inner index, which keeps
+    // the new inner indices sorted.
+    starts_.assign(outer_size() + 1, 0);
+    for (const auto index : matrix.indices_) { ++starts_[index + 1]; }
+    for (std::size_t k = 0; k < outer_size(); ++k) {
+        starts_[k + 1] += starts_[k];
+    }
+
+    indices_.resize(matrix.nnz());
+    values_.resize(matrix.nnz());
+    auto next = starts_;
+    for (std::size_t k = 0; k < matrix.outer_size(); ++k) {
+        for (auto p = matrix.starts_[k]; p < matrix.starts_[k + 1]; ++p) {
+            const auto position = next[matrix.indices_[p]]++;
+            indices_[position] = k;
+            values_[position] = static_cast<T>(matrix.values_[p]);
+        }
+    }
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+auto SparseMatrix<T, Format>::at(std::size_t row, std::size_t col) const -> T
+{
+    if (row >= rows_ or col >= cols_) {
+        throw std::out_of_range{ "SparseMatrix::at: index out of range" };
+    }
+
+    const auto outer = outer_of(row, col);
+    const auto first = indices_.begin()
+                       + static_cast<std::ptrdiff_t>(starts_[outer]);
+    const auto last = indices_.begin()
+                      + static_cast<std::ptrdiff_t>(starts_[outer + 1]);
+    const auto found = std::lower_bound(first, last, inner_of(row, col));
+    if (found == last or *found != inner_of(row, col)) { return T{}; }
+
+    return values_[static_cast<std::size_t>(found - indices_.begin())];
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+auto SparseMatrix<T, Format>::to_dense() const -> DynamicMatrix<T>
+{
+    DynamicMatrix<T> result(rows_, cols_);
+    for (std::size_t k = 0; k < outer_size(); ++k) {
+        for (auto p = starts_[k]; p < starts_[k + 1]; ++p) {
+            const auto row = Format == sparse_format::csr ? k : indices_[p];
+            const auto col = Format == sparse_format::csr ? indices_[p] : k;
+            result.data()[row * cols_ + col] = values_[p];
+        }
+    }
+    return result;
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+auto SparseMatrix<T, Format>::transpose() const -> SparseMatrix<
+    T,
+    Format == sparse_format::csr ? sparse_format::csc : sparse_format::csr>
+{
+    SparseMatrix<
+        T,
+        Format == sparse_format::csr ? sparse_format::csc : sparse_format::csr>
+        result;
+    result.rows_ = cols_;
+    result.cols_ = rows_;
+    result.starts_ = starts_;
+    result.indices_ = indices_;
+    result.values_ = values_;
+    return result;
+}
+
+template <detail::Arithmetic T, sparse_format Format>
+auto SparseMatrix<T, Format>::is_diagonal() const noexcept -> bool
+{
+    if (rows_ != cols_) { return false; }
+
+    for (std::size_t k = 0; k < outer_size(); ++k) {
+        for (auto p = starts_[k]; p < starts_[k + 1]; ++p) {
+            if (indices_[p] != k and values_[p] != T{}) { return false; }
+        }
+    }
+    return true;
+}
+
+// Sparse times dense: every stored element a(i, j) adds a(i, j) * b(j, :) to
+// row i of the result, so both operands and the result are walked row-wise.
+// Rows of a CSR operand are independent and are shared across the pool of
+// `policy`; a CSC operand scatters into arbitrary rows and runs sequentially.
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    sparse_format Format,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+auto multiply(
+    const P& policy,
+    const SparseMatrix<T, Format>& lhs,
+    const Matrix<U, A, B>& rhs) -> DynamicMatrix<std::common_type_t<T, U>>
+{
+    using result_type = std::common_type_t<T, U>;
+
+    if (lhs.col_size() != rhs.row_size()) {
+        throw std::logic_error{ "SparseMatrix::invalid size" };
+    }
+
+    const auto width = rhs.col_size();
+    DynamicMatrix<result_type> result(lhs.row_size(), width);
+    auto* out = result.data();
+    const auto* dense = rhs.data();
+    const auto starts = lhs.outer_starts();
+    const auto indices = lhs.inner_indices();
+    const auto values = lhs.values();
+
+    const auto accumulate = [out, dense, width](
+                                std::size_t row,
+                                std::size_t col,
+                                T value) {
+        auto* dst = out + row * width;
+        const auto* src = dense + col * width;
+        for (std::size_t j = 0; j < width; ++j) {
+            dst[j] = static_cast<result_type>(
+                dst[j]
+                + static_cast<result_type>(value)
+                      * static_cast<result_type>(src[j]));
+        }
+    };
+
+    if constexpr (Format == sparse_format::csr) {
+        detail::for_each_chunk(
+            policy,
+            lhs.row_size(),
+            std::max<std::size_t>(
+                detail::elementwise_grain
+                    * lhs.row_size()
+                    / std::max<std::size_t>(lhs.nnz() * width, 1),
+                1),
+            [&](std::size_t begin, std::size_t end) {
+                for (auto row = begin; row < end; ++row) {
+                    for (auto p = starts[row]; p < starts[row + 1]; ++p) {
+                        accumulate(row, indices[p], values[p]);
+                    }
+                }
+            });
+    }
+    else {
+        for (std::size_t col = 0; col < lhs.col_size(); ++col) {
+            for (auto p = starts[col]; p < starts[col + 1]; ++p) {
+                accumulate(indices[p], col, values[p]);
+            }
+        }
+    }
+
+    return result;
+}
+
+template <
+    detail::Arithmetic T,
+    sparse_format Format,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+auto multiply(const SparseMatrix<T, Format>& lhs, const Matrix<U, A, B>& rhs)
+    -> DynamicMatrix<std::common_type_t<T, U>>
+{
+    return multiply(execution::seq, lhs, rhs);
+}
+
+template <
+    detail::Arithmetic T,
+    sparse_format Format,
+    detail::Arithmetic U,
+    std::size_t A,
+    std::size_t B>
+auto operator*(const SparseMatrix<T, Format>& lhs, const Matrix<U, A, B>& rhs)
+    -> DynamicMatrix<std::common_type_t<T, U>>
+{
+    return multiply(execution::seq, lhs, rhs);
+}
+
+// Sparse matrix-vector product y = A x.
+template <detail::Arithmetic T, sparse_format Format, detail::Arithmetic U>
+auto multiply(const SparseMatrix<T, Format>& lhs, const std::vector<U>& rhs)
+    -> std::vector<std::common_type_t<T, U>>
+{
+    using result_type = std::common_type_t<T, U>;
+
+    if (lhs.col_size() != rhs.size()) {
+        throw std::logic_error{ "SparseMatrix::invalid vector size" };
+    }
+
+    std::vector<result_type> result(lhs.row_size());
+    const auto starts = lhs.outer_starts();
+    const auto indices = lhs.inner_indices();
+    const auto values = lhs.values();
+
+    for (std::size_t k = 0; k < lhs.outer_size(); ++k) {
+        if constexpr (Format == sparse_format::csr) {
+            auto sum = result_type{};
+            for (auto p = starts[k]; p < starts[k + 1]; ++p) {
+                sum = static_cast<result_type>(
+                    sum
+                    + static_cast<result_type>(values[p])
+                          * static_cast<result_type>(rhs[indices[p]]));
+            }
+            result[k] = sum;
+        }
+        else {
+            const auto x = static_cast<result_type>(rhs[k]);
+            for (auto p = starts[k]; p < starts[k + 1]; ++p) {
+                result[indices[p]] = static_cast<result_type>(
+                    result[indices[p]]
+                    + static_cast<result_type>(values[p]) * x);
+            }
+        }
+    }
+
+    return result;
+}
+
+}  // namespace mtl
+
+#endif  // MTL_SPARSE_HPP
@@ -0,0 +1,542 @@
+#ifndef MTL_STREAMING_HPP
+#define MTL_STREAMING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "io.hpp"
+#include "matrix.hpp"
+
+// Out-of-core operations on matrix files in the format of io.hpp. Operands
+// are streamed through a bounded set of tile buffers, and the tiles of the
+// next step are read on a background thread while the current ones are
+// being computed on.
+namespace mtl {
+
+struct streaming_options {
+    // Upper bound on the bytes held in tile buffers at any time. The blocked
+    // kernel adds its packing panels, a few hundred kilobytes at most.
+    std::size_t memory_budget{ std::size_t{ 64 } << 20U };
+};
+
+// Matrix stored in a file, accessed a block at a time. Every access opens
+// its own stream, so blocks may be read and written from several threads.
+template <detail::Arithmetic T>
+class FileMatrix final {
+   public:
+    using value_type = T;
+
+    explicit FileMatrix(std::filesystem::path path);
+
+    // Creates (or truncates) the file at `path` for a rows x cols matrix
+    // whose elements start out zero.
+    static auto create(
+        std::filesystem::path path,
+        std::size_t rows,
+        std::size_t cols) -> FileMatrix;
+
+    [[nodiscard]] auto path() const noexcept -> const std::filesystem::path&
+    {
+        return path_;
+    }
+
+    [[nodiscard]] auto row_size() const noexcept -> std::size_t
+    {
+        return rows_;
+    }
+
+    [[nodiscard]] auto col_size() const noexcept -> std::size_t
+    {
+        return cols_;
+    }
+
+    [[nodiscard]] auto size() const noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+        return { rows_, cols_ };
+    }
+
+    // Copies `count` elements, starting at row-major index `first`, to `out`.
+    auto read_elements(std::size_t first, std::size_t count, T* out) const
+        -> void;
+
+    // Stores `count` elements from `in`, starting at row-major index `first`.
+    auto write_elements(std::size_t first, std::size_t count, const T* in)
+        const -> void;
+
+    // Copies the rows x cols block at (row, col) to `out`, row-major.
+    auto read(
+        std::size_t row,
+        std::size_t col,
+        std::size_t rows,
+        std::size_t cols,
+        T* out) const -> void;
+
+    // Stores the row-major rows x cols block `in` at (row, col).
+    auto write(
+        std::size_t row,
+        std::size_t col,
+        std::size_t rows,
+        std::size_t cols,
+        const T* in) const -> void;
+
+   private:
+    FileMatrix(
+        std::filesystem::path path,
+        std::size_t rows,
+        std::size_t cols,
+        std::uint64_t offset) noexcept
+        : path_{ std::move(path) }, rows_{ rows }, cols_{ cols },
+          offset_{ offset }
+    {
+    }
+
+    auto check_block(
+        std::size_t row,
+        std::size_t col,
+        std::size_t rows,
+        std::size_t cols) const -> void
+    {
+        if (row + rows > rows_ or col + cols > cols_) {
+            throw std::out_of_range{ "FileMatrix: block out of range" };
+        }
+    }
+
+    [[nodiscard]] auto position(std::size_t index) const noexcept
+        -> std::streamoff
+    {
+        return static_cast<std::streamoff>(offset_ + index * sizeof(T));
+    }
+
+    std::filesystem::path path_;
+    std::size_t rows_{ 0 };
+    std::size_t cols_{ 0 };
+    std::uint64_t offset_{ 0 };
+};
+
+template <detail::Arithmetic T>
+FileMatrix<T>::FileMatrix(std::filesystem::path path)
+    : path_{ std::move(path) }
+{
+    std::ifstream stream{ path_, std::ios::binary };
+    detail::file_header header;
+    if (not stream.read(
+            reinterpret_cast<char*>(&header),
+            static_cast<std::streamsize>(sizeof(header)))) {
+        throw std::runtime_error{ "mtl::load: cannot open " + path_.string() };
+    }
+
+    const auto bytes = detail::check_header<T>(header);
+    if (std::filesystem::file_size(path_) < header.data_offset + bytes) {
+        throw std::runtime_error{ "mtl::load: truncated matrix file" };
+    }
+    rows_ = static_cast<std::size_t>(header.rows);
+    cols_ = static_cast<std::size_t>(header.cols);
+    offset_ = header.data_offset;
+}
+
+template <detail::Arithmetic T>
+auto FileMatrix<T>::create(
+    std::filesystem::path path,
+    std::size_t rows,
+    std::size_t cols) -> FileMatrix
+{
+    detail::file_header header;
+    header.type = detail::dtype_of<T>();
+    header.element_size = sizeof(T);
+    header.rows = rows;
+    header.cols = cols;
+
+    {
+        std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+        if (not stream.write(
+                reinterpret_cast<const char*>(&header),
+                static_cast<std::streamsize>(sizeof(header)))) {
+            throw std::runtime_error{
+                "mtl::save: cannot open " + path.string()
+            };
+        }
+    }
+    std::filesystem::resize_file(
+        path,
+        header.data_offset + rows * cols * sizeof(T));
+
+    return FileMatrix{ std::move(path), rows, cols, header.data_offset };
+}
+
+template <detail::Arithmetic T>
+auto FileMatrix<T>::read_elements(
+    std::size_t first,
+    std::size_t count,
+    T* out) const -> void
+{
+    if (first + count > rows_ * cols_) {
+        throw std::out_of_range{ "FileMatrix: block out of range" };
+    }
+    std::ifstream stream{ path_, std::ios::binary };
+    stream.seekg(position(first));
+    stream.read(
+        reinterpret_cast<char*>(out),
+        static_cast<std::streamsize>(count * sizeof(T)));
+    if (not stream) { throw std::runtime_error{ "FileMatrix: read failed" }; }
+}
+
+template <detail::Arithmetic T>
+auto FileMatrix<T>::write_elements(
+    std::size_t first,
+    std::size_t count,
+    const T* in) const -> void
+{
+    if (first + count > rows_ * cols_) {
+        throw std::out_of_range{ "FileMatrix: block out of range" };
+    }
+    std::fstream stream{
+        path_,
+        std::ios::binary | std::ios::in | std::ios::out
+    };
+    stream.seekp(position(first));
+    stream.write(
+        reinterpret_cast<const char*>(in),
+        static_cast<std::streamsize>(count * sizeof(T)));
+    if (not stream) { throw std::runtime_error{ "FileMatrix: write failed" }; }
+}
+
+template <detail::Arithmetic T>
+auto FileMatrix<T>::read(
+    std::size_t row,
+    std::size_t col,
+    std::size_t rows,
+    std::size_t cols,
+    T* out) const -> void
+{
+    check_block(row, col, rows, cols);
+    if (cols == cols_) {
+        read_elements(row * cols_, rows * cols, out);
+        return;
+    }
+
+    std::ifstream stream{ path_, std::ios::binary };
+    for (std::size_t i = 0; i < rows; ++i) {
+        stream.seekg(position((row + i) * cols_ + col));
+        stream.read(
+            reinterpret_cast<char*>(out + i * cols),
+            static_cast<std::streamsize>(cols * sizeof(T)));
+    }
+    if (not stream) { throw std::runtime_error{ "FileMatrix: read failed" }; }
+}
+
+template <detail::Arithmetic T>
+auto FileMatrix<T>::write(
+    std::size_t row,
+    std::size_t col,
+    std::size_t rows,
+    std::size_t cols,
+    const T* in) const -> void
+{
+    check_block(row, col, rows, cols);
+    if (cols == cols_) {
+        write_elements(row * cols_, rows * cols, in);
+        return;
+    }
+
+    std::fstream stream{
+        path_,
+        std::ios::binary | std::ios::in | std::ios::out
+    };
+    for (std::size_t i = 0; i < rows; ++i) {
+        stream.seekp(position((row + i) * cols_ + col));
+        stream.write(
+            reinterpret_cast<const char*>(in + i * cols),
+            static_cast<std::streamsize>(cols * sizeof(T)));
+    }
+    if (not stream) { throw std::runtime_error{ "FileMatrix: write failed" }; }
+}
+
+namespace detail {
+
+// create() truncates the output file before any operand is read, so writing
+// over an operand would destroy it.
+template <class T>
+auto check_distinct(
+    const std::filesystem::path& out,
+    const FileMatrix<T>& operand) -> void
+{
+    std::error_code error;
+    if (std::filesystem::equivalent(out, operand.path(), error)) {
+        throw std::logic_error{ "Matrix::output aliases an operand" };
+    }
+}
+
+// Largest square tile side such that `buffers` tiles fit the budget.
+template <class T>
+auto tile_side(std::size_t budget, std::size_t buffers) noexcept
+    -> std::size_t
+{
+    const auto elements = budget / (buffers * sizeof(T));
+    auto side = static_cast<std::size_t>(
+        std::sqrt(static_cast<double>(elements)));
+    while (side * side > elements) { --side; }
+    return std::max<std::size_t>(side, 1);
+}
+
+// Runs `compute` on the buffers filled by `fetch` for every step in turn,
+// fetching the next step on another thread meanwhile. Two sets of buffers
+// circulate between the reader and the caller.
+template <class Buffers, class Fetch, class Compute>
+auto double_buffered(
+    std::size_t steps,
+    Buffers front,
+    Buffers back,
+    const Fetch& fetch,
+    const Compute& compute) -> void
+{
+    if (steps == 0) { return; }
+
+    const auto prefetch = [&fetch](std::size_t step, Buffers buffers) {
+        return std::async(
+            std::launch::async,
+            [&fetch, step](Buffers target) {
+                fetch(step, target);
+                return target;
+            },
+            std::move(buffers));
+    };
+
+    auto pending = prefetch(0, std::move(front));
+    for (std::size_t step = 0; step < steps; ++step) {
+        auto current = pending.get();
+        if (step + 1 < steps) { pending = prefetch(step + 1, std::move(back)); }
+        compute(step, current);
+        back = std::move(current);
+    }
+}
+
+template <class T>
+struct product_tiles {
+    std::vector<T> a;
+    std::vector<T> b;
+};
+
+}  // namespace detail
+
+// Computes lhs * rhs into a new matrix file at `out` tile by tile. Five
+// square tiles live at once: two pairs of operand tiles and the result tile
+// that the products are accumulated into.
+template <execution::Policy P, detail::Arithmetic T>
+auto multiply(
+    const P& policy,
+    const FileMatrix<T>& lhs,
+    const FileMatrix<T>& rhs,
+    std::filesystem::path out,
+    const streaming_options& options = {}) -> FileMatrix<T>
+{
+    if (lhs.col_size() != rhs.row_size()) {
+        throw std::logic_error{ "Matrix::invalid size" };
+    }
+
+    const auto m = lhs.row_size();
+    const auto n = rhs.col_size();
+    const auto k = lhs.col_size();
+    detail::check_distinct(out, lhs);
+    detail::check_distinct(out, rhs);
+    auto result = FileMatrix<T>::create(std::move(out), m, n);
+    if (m == 0 or n == 0 or k == 0) { return result; }
+
+    const auto side = detail::tile_side<T>(options.memory_budget, 5);
+    const auto tiles = [side](std::size_t extent) {
+        return (extent + side - 1) / side;
+    };
+    const auto m_tiles = tiles(m);
+    const auto n_tiles = tiles(n);
+    const auto k_tiles = tiles(k);
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::multiply,
+        2 * m * n * k
+    };
+
+    // Steps run over k fastest, so that a result tile is complete, and can
+    // be written, after k_tiles consecutive steps.
+    struct step {
+        std::size_t row, col, inner, rows, cols, depth;
+    };
+    const auto step_at = [&](std::size_t index) {
+        const auto p = index % k_tiles;
+        const auto j = index / k_tiles % n_tiles;
+        const auto i = index / k_tiles / n_tiles;
+        return step{
+            i * side,
+            j * side,
+            p * side,
+            std::min(side, m - i * side),
+            std::min(side, n - j * side),
+            std::min(side, k - p * side),
+        };
+    };
+
+    const auto fetch = [&](std::size_t index,
+                           detail::product_tiles<T>& buffers) {
+        const auto s = step_at(index);
+        lhs.read(s.row, s.inner, s.rows, s.depth, buffers.a.data());
+        rhs.read(s.inner, s.col, s.depth, s.cols, buffers.b.data());
+    };
+
+    std::vector<T> accumulated(side * side);
+    const auto compute = [&](std::size_t index,
+                             const detail::product_tiles<T>& buffers) {
+        const auto s = step_at(index);
+        const auto first = index % k_tiles == 0;
+        detail::gemm(
+            policy,
+            s.rows,
+            s.cols,
+            s.depth,
+            accumulator_t<T>{ 1 },
+            buffers.a.data(),
+            s.depth,
+            std::size_t{ 1 },
+            buffers.b.data(),
+            s.cols,
+            std::size_t{ 1 },
+            first ? accumulator_t<T>{} : accumulator_t<T>{ 1 },
+            accumulated.data(),
+            s.cols);
+        if (index % k_tiles == k_tiles - 1) {
+            result.write(s.row, s.col, s.rows, s.cols, accumulated.data());
+        }
+    };
+
+    const auto make_tiles = [side] {
+        return detail::product_tiles<T>{
+            std::vector<T>(side * side),
+            std::vector<T>(side * side),
+        };
+    };
+    detail::double_buffered(
+        m_tiles * n_tiles * k_tiles,
+        make_tiles(),
+        make_tiles(),
+        fetch,
+        compute);
+
+    return result;
+}
+
+template <detail::Arithmetic T>
+auto multiply(
+    const FileMatrix<T>& lhs,
+    const FileMatrix<T>& rhs,
+    std::filesystem::path out,
+    const streaming_options& options = {}) -> FileMatrix<T>
+{
+    return multiply(execution::seq, lhs, rhs, std::move(out), options);
+}
+
+// Writes op(lhs(i, j), rhs(i, j)) for every element to a new matrix file at
+// `out`, streaming both operands in contiguous chunks.
+template <detail::Arithmetic T, class F>
+auto transform(
+    const FileMatrix<T>& lhs,
+    const FileMatrix<T>& rhs,
+    std::filesystem::path out,
+    F op,
+    const streaming_options& options = {}) -> FileMatrix<T>
+{
+    if (lhs.size() != rhs.size()) {
+        throw std::logic_error{ "Matrix::invalid size" };
+    }
+
+    detail::check_distinct(out, lhs);
+    detail::check_distinct(out, rhs);
+    auto result = FileMatrix<T>::create(
+        std::move(out),
+        lhs.row_size(),
+        lhs.col_size());
+
+    // Two pairs of input chunks in flight plus the output chunk.
+    const auto total = lhs.row_size() * lhs.col_size();
+    const auto chunk = std::max<std::size_t>(
+        options.memory_budget / (5 * sizeof(T)),
+        1);
+    const auto count_at = [&](std::size_t step) {
+        return std::min(chunk, total - step * chunk);
+    };
+
+    const auto fetch = [&](std::size_t step,
+                           detail::product_tiles<T>& buffers) {
+        lhs.read_elements(step * chunk, count_at(step), buffers.a.data());
+        rhs.read_elements(step * chunk, count_at(step), buffers.b.data());
+    };
+
+    const auto buffer = std::min(chunk, total);
+    std::vector<T> output(buffer);
+    const auto compute = [&](std::size_t step,
+                             const detail::product_tiles<T>& buffers) {
+        const auto count = static_cast<std::ptrdiff_t>(count_at(step));
+        std::transform(
+            buffers.a.begin(),
+            buffers.a.begin() + count,
+            buffers.b.begin(),
+            output.begin(),
+            [&op](T x, T y) { return static_cast<T>(op(x, y)); });
+        result.write_elements(step * chunk, count_at(step), output.data());
+    };
+
+    const auto make_chunks = [buffer] {
+        return detail::product_tiles<T>{
+            std::vector<T>(buffer),
+            std::vector<T>(buffer),
+        };
+    };
+    detail::double_buffered(
+        (total + chunk - 1) / chunk,
+        make_chunks(),
+        make_chunks(),
+        fetch,
+        compute);
+
+    return result;
+}
+
+template <detail::Arithmetic T>
+auto add(
+    const FileMatrix<T>& lhs,
+    const FileMatrix<T>& rhs,
+    std::filesystem::path out,
+    const streaming_options& options = {}) -> FileMatrix<T>
+{
+    return transform(
+        lhs,
+        rhs,
+        std::move(out),
+        [](T x, T y) { return x + y; },
+        options);
+}
+
+template <detail::Arithmetic T>
+auto subtract(
+    const FileMatrix<T>& lhs,
+    const FileMatrix<T>& rhs,
+    std::filesystem::path out,
+    const streaming_options& options = {}) -> FileMatrix<T>
+{
+    return transform(
+        lhs,
+        rhs,
+        std::move(out),
+        [](T x, T y) { return x - y; },
+        options);
+}
+
+}  // namespace mtl
+
+#endif  // MTL_STREAMING_HPP
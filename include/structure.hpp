@@ -0,0 +1,679 @@
+#ifndef MTL_STRUCTURE_HPP
+#define MTL_STRUCTURE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matrix.hpp"
+#include "vector.hpp"
+
+namespace mtl {
+
+// Square matrix that is zero off its diagonal, stored as the n diagonal
+// elements. It takes part in expressions like a view; products with it scale
+// the rows or columns of the other operand in O(n^2) instead of running the
+// O(n^3) product kernel.
+template <detail::Arithmetic T, std::size_t N = dynamic>
+class DiagonalMatrix final {
+   public:
+    using value_type = T;
+    static constexpr std::size_t rows_extent = N;
+    static constexpr std::size_t cols_extent = N;
+    static constexpr bool fixed_shape = N != dynamic;
+
+    constexpr DiagonalMatrix() = default;
+
+    constexpr explicit DiagonalMatrix(std::size_t size, T value = T{})
+        requires(N == dynamic)
+        : diagonal_(size, value)
+    {
+    }
+
+    constexpr explicit DiagonalMatrix(T value)
+        requires(N != dynamic)
+        : diagonal_(value)
+    {
+    }
+
+    constexpr DiagonalMatrix(std::initializer_list<T> diagonal)
+        : diagonal_(diagonal)
+    {
+    }
+
+    constexpr explicit DiagonalMatrix(Vector<T, N> diagonal)
+        : diagonal_(std::move(diagonal))
+    {
+    }
+
+    // Throws std::logic_error unless `matrix` is diagonal.
+    template <detail::Arithmetic U, std::size_t I, std::size_t J>
+        requires detail::SameShape<DiagonalMatrix, Matrix<U, I, J>>
+    constexpr explicit DiagonalMatrix(const Matrix<U, I, J>& matrix);
+
+    [[nodiscard]] static constexpr auto identity(std::size_t size)
+        -> DiagonalMatrix
+        requires(N == dynamic)
+    {
+        return DiagonalMatrix(size, T{ 1 });
+    }
+
+    [[nodiscard]] static constexpr auto identity() -> DiagonalMatrix
+        requires(N != dynamic)
+    {
+        return DiagonalMatrix(T{ 1 });
+    }
+
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return diagonal_.size();
+    }
+
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return diagonal_.size();
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+        return { row_size(), col_size() };
+    }
+
+    [[nodiscard]] constexpr auto diagonal() const noexcept
+        -> const Vector<T, N>&
+    {
+        return diagonal_;
+    }
+
+    [[nodiscard]] constexpr auto diagonal() noexcept -> Vector<T, N>&
+    {
+        return diagonal_;
+    }
+
+    [[nodiscard]] constexpr auto operator()(
+        std::size_t row,
+        std::size_t col) const -> T
+    {
+        detail::check_index(
+            row < row_size() and col < col_size(),
+            "DiagonalMatrix: index out of range");
+        return row == col ? diagonal_[row] : T{};
+    }
+
+    [[nodiscard]] constexpr auto element(std::size_t index) const noexcept
+        -> T
+    {
+        const auto row = index / col_size();
+        return index % col_size() == row ? diagonal_[row] : T{};
+    }
+
+    // Product of the diagonal, in O(n).
+    [[nodiscard]] constexpr auto det() const noexcept -> accumulator_t<T>
+    {
+        accumulator_t<T> determinant{ 1 };
+        for (const auto& value : diagonal_) {
+            determinant = static_cast<accumulator_t<T>>(
+                determinant * static_cast<accumulator_t<T>>(value));
+        }
+        return determinant;
+    }
+
+    [[nodiscard]] constexpr auto is_identity() const noexcept -> bool
+    {
+        return std::ranges::all_of(
+            diagonal_,
+            [](const T& value) { return value == T{ 1 }; });
+    }
+
+    [[nodiscard]] constexpr auto to_matrix() const -> Matrix<T, N, N>
+    {
+        return Matrix<T, N, N>{ *this };
+    }
+
+   private:
+    Vector<T, N> diagonal_;
+};
+
+template <detail::Arithmetic T, std::size_t N>
+template <detail::Arithmetic U, std::size_t I, std::size_t J>
+    requires detail::SameShape<DiagonalMatrix<T, N>, Matrix<U, I, J>>
+constexpr DiagonalMatrix<T, N>::DiagonalMatrix(const Matrix<U, I, J>& matrix)
+{
+    if (not matrix.is_diagonal()) {
+        throw std::logic_error{ "DiagonalMatrix::not diagonal" };
+    }
+    if constexpr (N == dynamic) { diagonal_.resize(matrix.row_size()); }
+    for (std::size_t i = 0; i < row_size(); ++i) {
+        diagonal_[i] = static_cast<T>(matrix(i, i));
+    }
+}
+
+template <detail::Arithmetic T>
+using DynamicDiagonalMatrix = DiagonalMatrix<T, dynamic>;
+
+// Symmetric matrix stored as its lower triangle, packed row by row:
+// element (i, j) with j <= i is at i * (i + 1) / 2 + j, and (j, i) refers to
+// the same element, so writes keep the matrix symmetric. It takes half the
+// memory of a dense matrix, which suits covariance and Gram matrices; it
+// takes part in expressions like a view, and products with a matrix evaluate
+// it to dense storage first.
+template <detail::Arithmetic T, std::size_t N = dynamic>
+class SymmetricMatrix final {
+   public:
+    using value_type = T;
+    static constexpr std::size_t rows_extent = N;
+    static constexpr std::size_t cols_extent = N;
+    static constexpr bool fixed_shape = N != dynamic;
+
+    [[nodiscard]] static constexpr auto packed_size(std::size_t size) noexcept
+        -> std::size_t
+    {
+        return size * (size + 1) / 2;
+    }
+
+    constexpr SymmetricMatrix() = default;
+
+    constexpr explicit SymmetricMatrix(std::size_t size, T value = T{})
+        requires(N == dynamic)
+        : elements_(packed_size(size), value, current_resource()), size_{ size }
+    {
+    }
+
+    constexpr explicit SymmetricMatrix(T value)
+        requires(N != dynamic)
+    {
+        std::ranges::fill(elements_, value);
+    }
+
+    // Copies the lower triangle of a square operand; the upper triangle is
+    // not read.
+    template <detail::MatrixOperand M>
+        requires detail::SameShape<SymmetricMatrix, M>
+    constexpr explicit SymmetricMatrix(const M& source);
+
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+        return { size_, size_ };
+    }
+
+    // The packed lower triangle.
+    [[nodiscard]] constexpr auto packed() const noexcept -> std::span<const T>
+    {
+        return elements_;
+    }
+
+    [[nodiscard]] constexpr auto packed() noexcept -> std::span<T>
+    {
+        return elements_;
+    }
+
+    [[nodiscard]] constexpr auto operator()(std::size_t row, std::size_t col)
+        -> T&
+    {
+        detail::check_index(
+            row < size_ and col < size_,
+            "SymmetricMatrix: index out of range");
+        return unchecked(row, col);
+    }
+
+    [[nodiscard]] constexpr auto operator()(
+        std::size_t row,
+        std::size_t col) const -> const T&
+    {
+        detail::check_index(
+            row < size_ and col < size_,
+            "SymmetricMatrix: index out of range");
+        return unchecked(row, col);
+    }
+
+    [[nodiscard]] constexpr auto unchecked(
+        std::size_t row,
+        std::size_t col) noexcept -> T&
+    {
+        return elements_[offset(row, col)];
+    }
+
+    [[nodiscard]] constexpr auto unchecked(
+        std::size_t row,
+        std::size_t col) const noexcept -> const T&
+    {
+        return elements_[offset(row, col)];
+    }
+
+    [[nodiscard]] constexpr auto element(std::size_t index) const noexcept
+        -> T
+    {
+        return elements_[offset(index / size_, index % size_)];
+    }
+
+    [[nodiscard]] constexpr auto to_matrix() const -> Matrix<T, N, N>
+    {
+        return Matrix<T, N, N>{ *this };
+    }
+
+    template <detail::Arithmetic U, std::size_t M>
+    [[nodiscard]] constexpr auto operator==(
+        const SymmetricMatrix<U, M>& other) const noexcept -> bool
+    {
+        return size_ == other.row_size()
+               and std::ranges::equal(elements_, other.packed());
+    }
+
+   private:
+    [[nodiscard]] static constexpr auto offset(
+        std::size_t row,
+        std::size_t col) noexcept -> std::size_t
+    {
+        if (row < col) { std::swap(row, col); }
+        return row * (row + 1) / 2 + col;
+    }
+
+    using storage_type = std::conditional_t<
+        N == dynamic,
+        std::pmr::vector<T>,
+        std::array<T, N == dynamic ? 0 : N * (N + 1) / 2>>;
+
+    [[nodiscard]] static constexpr auto storage(std::size_t size)
+        -> storage_type
+    {
+        if constexpr (N == dynamic) {
+            return storage_type(packed_size(size), current_resource());
+        }
+        else {
+            return storage_type{};
+        }
+    }
+
+    storage_type elements_{};
+    std::size_t size_{ N == dynamic ? 0 : N };
+};
+
+template <detail::Arithmetic T, std::size_t N>
+template <detail::MatrixOperand M>
+    requires detail::SameShape<SymmetricMatrix<T, N>, M>
+constexpr SymmetricMatrix<T, N>::SymmetricMatrix(const M& source)
+    : elements_{ storage(source.row_size()) }, size_{ source.row_size() }
+{
+    if (source.col_size() != size_ or (N != dynamic and size_ != N)) {
+        throw std::logic_error{ "Matrix::invalid size" };
+    }
+
+    auto* packed = elements_.data();
+    for (std::size_t i = 0; i < size_; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            *packed++ =
+                static_cast<T>(detail::element_of(source, i * size_ + j));
+        }
+    }
+}
+
+template <detail::Arithmetic T>
+using DynamicSymmetricMatrix = SymmetricMatrix<T, dynamic>;
+
+namespace detail {
+
+template <class T, std::size_t N>
+struct operand_traits<DiagonalMatrix<T, N>> {
+    using value_type = T;
+    using stored_type = const DiagonalMatrix<T, N>&;
+    static constexpr std::size_t rows_extent = N;
+    static constexpr std::size_t cols_extent = N;
+    static constexpr bool fixed_shape = N != dynamic;
+};
+
+template <class T, std::size_t N>
+struct operand_traits<SymmetricMatrix<T, N>> {
+    using value_type = T;
+    using stored_type = const SymmetricMatrix<T, N>&;
+    static constexpr std::size_t rows_extent = N;
+    static constexpr std::size_t cols_extent = N;
+    static constexpr bool fixed_shape = N != dynamic;
+};
+
+template <class T, std::size_t N>
+struct is_matrix_expression<DiagonalMatrix<T, N>> : std::true_type {};
+
+template <class T, std::size_t N>
+struct is_matrix_expression<SymmetricMatrix<T, N>> : std::true_type {};
+
+template <class T>
+struct is_diagonal_matrix : std::false_type {};
+
+template <class T, std::size_t N>
+struct is_diagonal_matrix<DiagonalMatrix<T, N>> : std::true_type {};
+
+template <class M>
+concept Diagonal = is_diagonal_matrix<std::remove_cvref_t<M>>::value;
+
+// Scales row i of `rhs` by diagonal[i] when `Rows`, and column j by
+// diagonal[j] otherwise, into a new matrix.
+template <bool Rows, class R, class T, execution::Policy P, StridedOperand M>
+constexpr auto scale_by_diagonal(
+    const P& policy,
+    const T* diagonal,
+    const M& operand,
+    std::size_t rows,
+    std::size_t cols) -> R
+{
+    using value_type = typename R::value_type;
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::multiply,
+        rows * cols
+    };
+
+    R result{ uninitialized, rows, cols };
+    instrumentation::detail::record_temporary(
+        rows * cols * sizeof(value_type));
+
+    const auto elements = strided(operand);
+    const auto grain = std::max<std::size_t>(
+        1,
+        elementwise_grain / std::max<std::size_t>(cols, 1));
+    for_each_chunk(
+        policy,
+        rows,
+        grain,
+        [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                const auto* src = elements.data + i * elements.row_stride;
+                auto* dst = result.data() + i * cols;
+                if constexpr (Rows and is_same_v<value_type, T>
+                              and is_same_v<value_type, operand_value_t<M>>
+                              and simd::Vectorizable<value_type>) {
+                    if (elements.col_stride == 1) {
+                        std::copy(src, src + cols, dst);
+                        simd::scale(dst, cols, diagonal[i]);
+                        continue;
+                    }
+                }
+                for (std::size_t j = 0; j < cols; ++j) {
+                    dst[j] = static_cast<value_type>(
+                        static_cast<value_type>(diagonal[Rows ? i : j])
+                        * static_cast<value_type>(
+                            src[j * elements.col_stride]));
+                }
+            }
+        });
+    return result;
+}
+
+}  // namespace detail
+
+// diag(d) * B: row i of B scaled by d[i].
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    std::size_t N,
+    detail::MatrixOperand R>
+    requires(not detail::Diagonal<R>
+             and detail::Multipliable<DiagonalMatrix<T, N>, R>)
+constexpr auto multiply(
+    const P& policy,
+    const DiagonalMatrix<T, N>& lhs,
+    const R& rhs) -> detail::operand_product_t<DiagonalMatrix<T, N>, R>
+{
+    if constexpr (detail::StridedOperand<R>) {
+        detail::check_multipliable(lhs, rhs);
+        return detail::scale_by_diagonal<
+            true,
+            detail::operand_product_t<DiagonalMatrix<T, N>, R>>(
+            policy,
+            lhs.diagonal().data(),
+            rhs,
+            rhs.row_size(),
+            rhs.col_size());
+    }
+    else {
+        return multiply(policy, lhs, detail::evaluate(rhs));
+    }
+}
+
+// B * diag(d): column j of B scaled by d[j].
+template <
+    execution::Policy P,
+    detail::MatrixOperand L,
+    detail::Arithmetic T,
+    std::size_t N>
+    requires(not detail::Diagonal<L>
+             and detail::Multipliable<L, DiagonalMatrix<T, N>>)
+constexpr auto multiply(
+    const P& policy,
+    const L& lhs,
+    const DiagonalMatrix<T, N>& rhs)
+    -> detail::operand_product_t<L, DiagonalMatrix<T, N>>
+{
+    if constexpr (detail::StridedOperand<L>) {
+        detail::check_multipliable(lhs, rhs);
+        return detail::scale_by_diagonal<
+            false,
+            detail::operand_product_t<L, DiagonalMatrix<T, N>>>(
+            policy,
+            rhs.diagonal().data(),
+            lhs,
+            lhs.row_size(),
+            lhs.col_size());
+    }
+    else {
+        return multiply(policy, detail::evaluate(lhs), rhs);
+    }
+}
+
+template <
+    detail::Arithmetic T,
+    std::size_t N,
+    detail::Arithmetic U,
+    std::size_t M>
+    requires detail::extents_match_v<N, M>
+constexpr auto multiply(
+    const DiagonalMatrix<T, N>& lhs,
+    const DiagonalMatrix<U, M>& rhs)
+    -> DiagonalMatrix<std::common_type_t<T, U>, detail::combined_extent_v<N, M>>
+{
+    using value_type = std::common_type_t<T, U>;
+    if (lhs.row_size() != rhs.row_size()) {
+        throw std::logic_error{ "Matrix::invalid size" };
+    }
+
+    DiagonalMatrix<value_type, detail::combined_extent_v<N, M>> result;
+    if constexpr (detail::combined_extent_v<N, M> == dynamic) {
+        result.diagonal().resize(lhs.row_size());
+    }
+    for (std::size_t i = 0; i < lhs.row_size(); ++i) {
+        result.diagonal()[i] = static_cast<value_type>(
+            static_cast<value_type>(lhs.diagonal()[i])
+            * static_cast<value_type>(rhs.diagonal()[i]));
+    }
+    return result;
+}
+
+template <detail::MatrixOperand L, detail::MatrixOperand R>
+    requires((detail::Diagonal<L> or detail::Diagonal<R>)
+             and detail::Multipliable<L, R>)
+constexpr auto multiply(const L& lhs, const R& rhs)
+{
+    return multiply(execution::seq, lhs, rhs);
+}
+
+template <
+    detail::Arithmetic T,
+    std::size_t N,
+    detail::MatrixOperand R>
+    requires detail::Multipliable<DiagonalMatrix<T, N>, R>
+constexpr auto operator*(const DiagonalMatrix<T, N>& lhs, const R& rhs)
+{
+    return multiply(lhs, rhs);
+}
+
+template <
+    detail::MatrixOperand L,
+    detail::Arithmetic T,
+    std::size_t N>
+    requires(not detail::Diagonal<L>
+             and detail::Multipliable<L, DiagonalMatrix<T, N>>)
+constexpr auto operator*(const L& lhs, const DiagonalMatrix<T, N>& rhs)
+{
+    return multiply(lhs, rhs);
+}
+
+// diag(d) * x: the element-wise product of d and x.
+template <
+    detail::Arithmetic T,
+    std::size_t N,
+    detail::Arithmetic U,
+    std::size_t M>
+    requires detail::extents_match_v<N, M>
+constexpr auto operator*(
+    const DiagonalMatrix<T, N>& lhs,
+    const Vector<U, M>& rhs)
+    -> Vector<std::common_type_t<T, U>, detail::combined_extent_v<N, M>>
+{
+    using result_type =
+        Vector<std::common_type_t<T, U>, detail::combined_extent_v<N, M>>;
+    using value_type = typename result_type::value_type;
+    if (lhs.col_size() != rhs.size()) {
+        throw std::logic_error{ "Matrix::invalid vector size" };
+    }
+
+    result_type result;
+    if constexpr (result_type::is_dynamic) { result.resize(rhs.size()); }
+    for (std::size_t i = 0; i < rhs.size(); ++i) {
+        result[i] = static_cast<value_type>(
+            static_cast<value_type>(lhs.diagonal()[i])
+            * static_cast<value_type>(rhs[i]));
+    }
+    return result;
+}
+
+// Symmetric matrix-vector product. Each packed row is read once: row i of
+// the lower triangle gives both y[i] += A[i, :i] x[:i] and, as column i of
+// the upper triangle, y[:i] += A[i, :i] x[i].
+template <
+    detail::Arithmetic T,
+    std::size_t N,
+    detail::Arithmetic U,
+    std::size_t M>
+    requires detail::extents_match_v<N, M>
+constexpr auto multiply(
+    const SymmetricMatrix<T, N>& lhs,
+    const Vector<U, M>& rhs) -> Vector<std::common_type_t<T, U>, N>
+{
+    using result_type = Vector<std::common_type_t<T, U>, N>;
+    using acc_type = accumulator_t<std::common_type_t<T, U>, T, U>;
+    const auto size = lhs.row_size();
+    if (size != rhs.size()) {
+        throw std::logic_error{ "Matrix::invalid vector size" };
+    }
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::multiply,
+        2 * size * size
+    };
+
+    std::vector<acc_type> sums(size);
+    const auto* row = lhs.packed().data();
+    for (std::size_t i = 0; i < size; row += ++i) {
+        const auto x = static_cast<acc_type>(rhs[i]);
+        auto sum = static_cast<acc_type>(row[i]) * x;
+        for (std::size_t j = 0; j < i; ++j) {
+            const auto a = static_cast<acc_type>(row[j]);
+            sum = static_cast<acc_type>(
+                sum + a * static_cast<acc_type>(rhs[j]));
+            sums[j] = static_cast<acc_type>(sums[j] + a * x);
+        }
+        sums[i] = static_cast<acc_type>(sums[i] + sum);
+    }
+
+    result_type result;
+    if constexpr (result_type::is_dynamic) { result.resize(size); }
+    for (std::size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<typename result_type::value_type>(sums[i]);
+    }
+    return result;
+}
+
+template <
+    detail::Arithmetic T,
+    std::size_t N,
+    detail::Arithmetic U,
+    std::size_t M>
+    requires detail::extents_match_v<N, M>
+constexpr auto operator*(
+    const SymmetricMatrix<T, N>& lhs,
+    const Vector<U, M>& rhs) -> Vector<std::common_type_t<T, U>, N>
+{
+    return multiply(lhs, rhs);
+}
+
+// The Gram matrix A^T A of the columns of `operand`, or the scatter matrix
+// of observations stored one per row, computing only its lower triangle.
+template <detail::MatrixOperand M>
+constexpr auto gram(const M& operand) -> SymmetricMatrix<
+    accumulator_t<detail::operand_value_t<M>>,
+    detail::operand_traits<M>::cols_extent>
+{
+    using acc_type = accumulator_t<detail::operand_value_t<M>>;
+    using result_type =
+        SymmetricMatrix<acc_type, detail::operand_traits<M>::cols_extent>;
+    if constexpr (detail::StridedOperand<M>) {
+        const auto size = operand.col_size();
+        auto result = [size] {
+            if constexpr (result_type::rows_extent == dynamic) {
+                return result_type(size);
+            }
+            else {
+                return result_type{};
+            }
+        }();
+
+        const instrumentation::detail::scoped_operation operation{
+            instrumentation::kind::multiply,
+            operand.row_size() * size * (size + 1)
+        };
+
+        using detail::strided;
+        const auto elements = strided(operand);
+        std::vector<acc_type> observation(size);
+        for (std::size_t r = 0; r < operand.row_size(); ++r) {
+            const auto* src = elements.data + r * elements.row_stride;
+            for (std::size_t j = 0; j < size; ++j) {
+                observation[j] =
+                    static_cast<acc_type>(src[j * elements.col_stride]);
+            }
+            auto* row = result.packed().data();
+            for (std::size_t i = 0; i < size; row += ++i) {
+                const auto x = observation[i];
+                for (std::size_t j = 0; j <= i; ++j) {
+                    row[j] = static_cast<acc_type>(row[j] + x * observation[j]);
+                }
+            }
+        }
+        return result;
+    }
+    else {
+        return gram(detail::evaluate(operand));
+    }
+}
+
+}  // namespace mtl
+
+#endif  // MTL_STRUCTURE_HPP
@@ -0,0 +1,304 @@
+#ifndef MTL_THREAD_POOL_HPP
+#define MTL_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace mtl {
+
+// Work-stealing pool used by the parallel overloads of the matrix operations.
+// Every worker owns a queue: it takes work from the back of its own queue and
+// steals from the front of the others when it runs dry. A thread waiting for
+// a parallel_for to finish runs queued work instead of blocking, so nested
+// parallel calls cannot deadlock the pool.
+class thread_pool final {
+   public:
+    // Starts `threads` workers. When `cpus` is not empty, worker i is pinned
+    // to cpus[i % cpus.size()] (Linux only, ignored elsewhere).
+    explicit thread_pool(
+        std::size_t threads = std::thread::hardware_concurrency(),
+        std::vector<unsigned> cpus = {});
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    auto operator=(const thread_pool&) -> thread_pool& = delete;
+    auto operator=(thread_pool&&) -> thread_pool& = delete;
+
+    ~thread_pool();
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return workers_.size();
+    }
+
+    // Splits [0, count) into chunks of at least `grain` indices and calls
+    // body(begin, end) for each of them, returning once all have finished.
+    // The first exception thrown by a chunk is rethrown to the caller.
+    template <class F>
+    auto parallel_for(std::size_t count, std::size_t grain, F&& body) -> void;
+
+    // Queues task() and returns a future for its result, or for the
+    // exception it throws. A task may itself call parallel_for on this pool,
+    // but should not wait on the future of another task of the same pool:
+    // the waiting worker would no longer run queued work.
+    template <class F>
+    auto async(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+
+   private:
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    auto submit(std::function<void()> task) -> void;
+    auto try_run_one() -> bool;
+    auto worker_loop(std::size_t index) -> void;
+
+    std::vector<std::unique_ptr<worker_queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::atomic<std::size_t> queued_{ 0 };
+    std::atomic<std::size_t> next_queue_{ 0 };
+    bool stop_{ false };
+
+    inline static thread_local thread_pool* current_pool_{ nullptr };
+    inline static thread_local std::size_t current_index_{ 0 };
+};
+
+inline thread_pool::thread_pool(std::size_t threads, std::vector<unsigned> cpus)
+{
+    threads = std::max<std::size_t>(threads, 1);
+    queues_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<worker_queue>());
+    }
+
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i] { worker_loop(i); });
+
+#if defined(__linux__)
+        if (not cpus.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus[i % cpus.size()], &set);
+            pthread_setaffinity_np(
+                workers_.back().native_handle(),
+                sizeof(set),
+                &set);
+        }
+#endif
+    }
+}
+
+inline thread_pool::~thread_pool()
+{
+    {
+        const std::lock_guard lock{ sleep_mutex_ };
+        stop_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto& worker : workers_) { worker.join(); }
+}
+
+inline auto thread_pool::submit(std::function<void()> task) -> void
+{
+    const auto index = current_pool_ == this
+                           ? current_index_
+                           : next_queue_++ % queues_.size();
+    {
+        const std::lock_guard lock{ sleep_mutex_ };
+        ++queued_;
+    }
+    {
+        const std::lock_guard lock{ queues_[index]->mutex };
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    wake_.notify_one();
+}
+
+inline auto thread_pool::try_run_one() -> bool
+{
+    const auto home =
+        current_pool_ == this ? current_index_ : next_queue_.load();
+
+    std::function<void()> task;
+    for (std::size_t offset = 0; offset < queues_.size() and not task;
+         ++offset) {
+        auto& queue = *queues_[(home + offset) % queues_.size()];
+        const std::lock_guard lock{ queue.mutex };
+        if (queue.tasks.empty()) { continue; }
+
+        if (offset == 0 and current_pool_ == this) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (not task) { return false; }
+
+    --queued_;
+    task();
+    return true;
+}
+
+inline auto thread_pool::worker_loop(std::size_t index) -> void
+{
+    current_pool_ = this;
+    current_index_ = index;
+
+    while (true) {
+        if (try_run_one()) { continue; }
+
+        std::unique_lock lock{ sleep_mutex_ };
+        wake_.wait(lock, [this] { return stop_ or queued_ > 0; });
+        if (stop_ and queued_ == 0) { return; }
+    }
+}
+
+template <class F>
+auto thread_pool::parallel_for(std::size_t count, std::size_t grain, F&& body)
+    -> void
+{
+    if (count == 0) { return; }
+
+    grain = std::max<std::size_t>(grain, 1);
+    const auto chunks = std::min((count + grain - 1) / grain, 4 * size());
+    if (chunks <= 1) {
+        body(std::size_t{ 0 }, count);
+        return;
+    }
+
+    struct shared_state {
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex;
+        std::exception_ptr error;
+    } state{ chunks - 1, {}, {} };
+
+    const auto run_chunk = [&state, &body, count, chunks](std::size_t chunk) {
+        try {
+            body(chunk * count / chunks, (chunk + 1) * count / chunks);
+        }
+        catch (...) {
+            const std::lock_guard lock{ state.mutex };
+            if (not state.error) { state.error = std::current_exception(); }
+        }
+    };
+
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        submit([&state, &run_chunk, chunk] {
+            run_chunk(chunk);
+            --state.remaining;
+        });
+    }
+
+    run_chunk(0);
+
+    while (state.remaining > 0) {
+        if (not try_run_one()) { std::this_thread::yield(); }
+    }
+
+    if (state.error) { std::rethrow_exception(state.error); }
+}
+
+template <class F>
+auto thread_pool::async(F&& task)
+    -> std::future<std::invoke_result_t<std::decay_t<F>>>
+{
+    // std::function needs a copyable target, so the move-only packaged task
+    // is shared with the queued wrapper.
+    using result_type = std::invoke_result_t<std::decay_t<F>>;
+    auto packaged = std::make_shared<std::packaged_task<result_type()>>(
+        std::forward<F>(task));
+    auto future = packaged->get_future();
+    submit([packaged] { (*packaged)(); });
+    return future;
+}
+
+namespace execution {
+
+struct sequenced_policy {};
+
+// Runs on `pool`, or on default_thread_pool() when it is null.
+struct parallel_policy {
+    thread_pool* pool{ nullptr };
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+[[nodiscard]] constexpr auto on(thread_pool& pool) noexcept -> parallel_policy
+{
+    return parallel_policy{ &pool };
+}
+
+template <class P>
+concept Policy = std::is_same_v<std::remove_cvref_t<P>, sequenced_policy>
+                 or std::is_same_v<std::remove_cvref_t<P>, parallel_policy>;
+
+}  // namespace execution
+
+// Pool behind execution::par; created on first use with one worker per
+// hardware thread. Pass execution::on(pool) to run on a pool of your own.
+inline auto default_thread_pool() -> thread_pool&
+{
+    static thread_pool pool;
+    return pool;
+}
+
+namespace detail {
+
+// The pool that runs work under `policy`; sequenced work that is handed off
+// at all goes to the default pool.
+template <execution::Policy P>
+inline auto pool_of(const P& policy) -> thread_pool&
+{
+    if constexpr (std::is_same_v<P, execution::parallel_policy>) {
+        if (policy.pool != nullptr) { return *policy.pool; }
+    }
+    return default_thread_pool();
+}
+
+template <execution::Policy P, class F>
+constexpr auto for_each_chunk(
+    const P& policy,
+    std::size_t count,
+    std::size_t grain,
+    F&& body) -> void
+{
+    if constexpr (std::is_same_v<P, execution::sequenced_policy>) {
+        if (count != 0) { body(std::size_t{ 0 }, count); }
+    }
+    else {
+        pool_of(policy).parallel_for(count, grain, std::forward<F>(body));
+    }
+}
+
+}  // namespace detail
+
+}  // namespace mtl
+
+#endif  // MTL_THREAD_POOL_HPP
@@ -0,0 +1,273 @@
+#ifndef MTL_VECTOR_HPP
+#define MTL_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matrix.hpp"
+
+namespace mtl {
+
+// Dense vector of N elements, or of a runtime number of elements when N is
+// mtl::dynamic. Fixed vectors keep their elements inline; runtime-sized
+// ones allocate from mtl::current_resource() like matrices do.
+template <detail::Arithmetic T, std::size_t N = dynamic>
+class Vector final {
+   public:
+    using value_type = T;
+    static constexpr std::size_t extent = N;
+    static constexpr bool is_dynamic = N == dynamic;
+
+    constexpr Vector() = default;
+
+    constexpr explicit Vector(std::size_t size, T value = T{})
+        requires is_dynamic
+        : elements_(size, value, current_resource())
+    {
+    }
+
+    constexpr explicit Vector(T value)
+        requires(not is_dynamic)
+    {
+        std::ranges::fill(elements_, value);
+    }
+
+    constexpr Vector(std::initializer_list<T> list)
+        : Vector(std::span<const T>{ list.begin(), list.size() })
+    {
+    }
+
+    constexpr explicit Vector(std::span<const T> elements)
+    {
+        if constexpr (is_dynamic) {
+            elements_.assign(elements.begin(), elements.end());
+        }
+        else {
+            if (elements.size() != N) {
+                throw std::logic_error{ "Vector::invalid size" };
+            }
+            std::ranges::copy(elements, elements_.begin());
+        }
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+    {
+        return elements_.size();
+    }
+
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return elements_.empty();
+    }
+
+    [[nodiscard]] constexpr auto data() noexcept -> T*
+    {
+        return elements_.data();
+    }
+
+    [[nodiscard]] constexpr auto data() const noexcept -> const T*
+    {
+        return elements_.data();
+    }
+
+    [[nodiscard]] constexpr auto begin() noexcept -> T* { return data(); }
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> const T*
+    {
+        return data();
+    }
+
+    [[nodiscard]] constexpr auto end() noexcept -> T*
+    {
+        return data() + size();
+    }
+
+    [[nodiscard]] constexpr auto end() const noexcept -> const T*
+    {
+        return data() + size();
+    }
+
+    [[nodiscard]] constexpr auto operator[](std::size_t index) noexcept
+        -> T&
+    {
+        return elements_[index];
+    }
+
+    [[nodiscard]] constexpr auto operator[](std::size_t index) const noexcept
+        -> const T&
+    {
+        return elements_[index];
+    }
+
+    [[nodiscard]] constexpr auto at(std::size_t index) -> T&
+    {
+        if (index >= size()) {
+            throw std::out_of_range{ "Vector: index out of range" };
+        }
+        return elements_[index];
+    }
+
+    [[nodiscard]] constexpr auto at(std::size_t index) const -> const T&
+    {
+        if (index >= size()) {
+            throw std::out_of_range{ "Vector: index out of range" };
+        }
+        return elements_[index];
+    }
+
+    constexpr auto resize(std::size_t size)
+        requires is_dynamic
+    {
+        elements_.resize(size);
+    }
+
+    template <detail::Arithmetic U, std::size_t M>
+    [[nodiscard]] constexpr auto operator==(
+        const Vector<U, M>& other) const noexcept -> bool
+    {
+        return std::ranges::equal(*this, other);
+    }
+
+   private:
+    std::conditional_t<
+        is_dynamic,
+        std::pmr::vector<T>,
+        std::array<T, is_dynamic ? 0 : N>>
+        elements_{};
+};
+
+template <detail::Arithmetic T>
+using DynamicVector = Vector<T, dynamic>;
+
+namespace detail {
+
+template <class R>
+using range_value_t = std::ranges::range_value_t<R>;
+
+template <class M, class X, class Y>
+constexpr auto check_gemv(const M& matrix, const X& x, const Y& y)
+{
+    if (matrix.col_size() != std::ranges::size(x)
+        or matrix.row_size() != std::ranges::size(y)) {
+        throw std::logic_error{ "Matrix::invalid vector size" };
+    }
+}
+
+template <class Acc, class M, class X, class Y>
+using gemv_accumulator_t = accumulator_for_t<
+    Acc,
+    range_value_t<Y>,
+    operand_value_t<M>,
+    range_value_t<X>>;
+
+}  // namespace detail
+
+// Fused y = alpha * matrix * x + beta * y into a caller-provided vector, span
+// or other contiguous range, without allocating. Products are summed in Acc,
+// by default mtl::accumulator_t of the element types. y is not read when beta
+// is zero.
+template <
+    class Acc = void,
+    execution::Policy P,
+    detail::StridedOperand M,
+    std::ranges::contiguous_range X,
+    std::ranges::contiguous_range Y>
+constexpr auto gemv(
+    const P& policy,
+    const detail::gemv_accumulator_t<Acc, M, X, Y>& alpha,
+    const M& matrix,
+    const X& x,
+    const detail::gemv_accumulator_t<Acc, M, X, Y>& beta,
+    Y&& y) -> void
+{
+    detail::check_gemv(matrix, x, y);
+    using detail::strided;
+    const auto a = strided(matrix);
+    detail::gemv(
+        policy,
+        matrix.row_size(),
+        matrix.col_size(),
+        alpha,
+        a.data,
+        a.row_stride,
+        a.col_stride,
+        std::ranges::data(x),
+        beta,
+        std::ranges::data(y));
+}
+
+template <
+    class Acc = void,
+    detail::StridedOperand M,
+    std::ranges::contiguous_range X,
+    std::ranges::contiguous_range Y>
+constexpr auto gemv(
+    const detail::gemv_accumulator_t<Acc, M, X, Y>& alpha,
+    const M& matrix,
+    const X& x,
+    const detail::gemv_accumulator_t<Acc, M, X, Y>& beta,
+    Y&& y) -> void
+{
+    gemv<Acc>(execution::seq, alpha, matrix, x, beta, std::forward<Y>(y));
+}
+
+template <
+    execution::Policy P,
+    detail::StridedOperand M,
+    detail::Arithmetic U,
+    std::size_t N>
+    requires detail::extents_match_v<
+        detail::operand_traits<M>::cols_extent,
+        N>
+constexpr auto multiply(
+    const P& policy,
+    const M& matrix,
+    const Vector<U, N>& x)
+    -> Vector<
+        std::common_type_t<detail::operand_value_t<M>, U>,
+        detail::operand_traits<M>::rows_extent>
+{
+    using result_type = Vector<
+        std::common_type_t<detail::operand_value_t<M>, U>,
+        detail::operand_traits<M>::rows_extent>;
+
+    result_type result;
+    if constexpr (result_type::is_dynamic) {
+        result.resize(matrix.row_size());
+    }
+    using acc_type =
+        detail::gemv_accumulator_t<void, M, Vector<U, N>, result_type>;
+    gemv(policy, acc_type{ 1 }, matrix, x, acc_type{}, result);
+    return result;
+}
+
+template <detail::StridedOperand M, detail::Arithmetic U, std::size_t N>
+    requires detail::extents_match_v<
+        detail::operand_traits<M>::cols_extent,
+        N>
+constexpr auto multiply(const M& matrix, const Vector<U, N>& x)
+{
+    return multiply(execution::seq, matrix, x);
+}
+
+template <detail::StridedOperand M, detail::Arithmetic U, std::size_t N>
+    requires detail::extents_match_v<
+        detail::operand_traits<M>::cols_extent,
+        N>
+constexpr auto operator*(const M& matrix, const Vector<U, N>& x)
+{
+    return multiply(execution::seq, matrix, x);
+}
+
+}  // namespace mtl
+
+#endif  // MTL_VECTOR_HPP
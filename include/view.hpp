@@ -0,0 +1,719 @@
+#ifndef MTL_VIEW_HPP
+#define MTL_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "matrix.hpp"
+
+namespace mtl {
+
+template <detail::Arithmetic T>
+class MatrixSpan;
+
+namespace detail {
+
+constexpr auto check_block(
+    std::size_t rows,
+    std::size_t cols,
+    std::size_t row,
+    std::size_t col,
+    std::size_t block_rows,
+    std::size_t block_cols)
+{
+    if (row > rows or col > cols or block_rows > rows - row
+        or block_cols > cols - col) {
+        throw std::out_of_range{ "MatrixView: block out of range" };
+    }
+}
+
+}  // namespace detail
+
+// Non-owning, read-only rows x cols window over elements that live
+// elsewhere: a matrix, a block of one, a memory-mapped file, a buffer from
+// another library. Element (row, col) is at data[row * row_stride + col *
+// col_stride], so blocks, rows, columns and transposes are views as well.
+// A view takes part in expressions and products like a runtime-sized matrix
+// and must not outlive the elements it refers to.
+template <detail::Arithmetic T>
+class MatrixView final {
+   public:
+    using value_type = T;
+    static constexpr std::size_t rows_extent = dynamic;
+    static constexpr std::size_t cols_extent = dynamic;
+    static constexpr bool fixed_shape = false;
+
+    constexpr MatrixView() noexcept = default;
+
+    constexpr MatrixView(
+        const T* data,
+        std::size_t rows,
+        std::size_t cols) noexcept
+        : MatrixView(data, rows, cols, cols, 1)
+    {
+    }
+
+    constexpr MatrixView(
+        const T* data,
+        std::size_t rows,
+        std::size_t cols,
+        std::size_t row_stride,
+        std::size_t col_stride) noexcept
+        : data_{ data },
+          rows_{ rows },
+          cols_{ cols },
+          row_stride_{ row_stride },
+          col_stride_{ col_stride }
+    {
+    }
+
+    template <std::size_t I, std::size_t J>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+    constexpr MatrixView(const Matrix<T, I, J>& matrix) noexcept
+        : MatrixView(matrix.data(), matrix.row_size(), matrix.col_size())
+    {
+    }
+
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return rows_;
+    }
+
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return cols_;
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+        return { rows_, cols_ };
+    }
+
+    [[nodiscard]] constexpr auto row_stride() const noexcept -> std::size_t
+    {
+        return row_stride_;
+    }
+
+    [[nodiscard]] constexpr auto col_stride() const noexcept -> std::size_t
+    {
+        return col_stride_;
+    }
+
+    // Whether the elements are row-major and back to back, as in a Matrix.
+    [[nodiscard]] constexpr auto is_contiguous() const noexcept -> bool
+    {
+        return (col_stride_ == 1 or cols_ <= 1)
+               and (row_stride_ == cols_ or rows_ <= 1);
+    }
+
+    [[nodiscard]] constexpr auto data() const noexcept -> const T*
+    {
+        return data_;
+    }
+
+    // Elements of a contiguous view.
+    [[nodiscard]] constexpr auto span() const -> std::span<const T>
+    {
+        if (not is_contiguous()) {
+            throw std::logic_error{ "MatrixView::not contiguous" };
+        }
+        return { data_, rows_ * cols_ };
+    }
+
+    [[nodiscard]] constexpr auto operator()(
+        std::size_t row,
+        std::size_t col) const -> const T&
+    {
+        detail::check_index(
+            row < rows_ and col < cols_,
+            "MatrixView: index out of range");
+        return unchecked(row, col);
+    }
+
+    [[nodiscard]] constexpr auto unchecked(
+        std::size_t row,
+        std::size_t col) const noexcept -> const T&
+    {
+        return data_[row * row_stride_ + col * col_stride_];
+    }
+
+    [[nodiscard]] constexpr auto element(std::size_t index) const noexcept
+        -> T
+    {
+        if (is_contiguous()) { return data_[index]; }
+        return data_[index / cols_ * row_stride_ + index % cols_ * col_stride_];
+    }
+
+    [[nodiscard]] constexpr auto block(
+        std::size_t row,
+        std::size_t col,
+        std::size_t rows,
+        std::size_t cols) const -> MatrixView
+    {
+        detail::check_block(rows_, cols_, row, col, rows, cols);
+        return { data_ + row * row_stride_ + col * col_stride_,
+                 rows,
+                 cols,
+                 row_stride_,
+                 col_stride_ };
+    }
+
+    [[nodiscard]] constexpr auto row(std::size_t index) const -> MatrixView
+    {
+        return block(index, 0, 1, cols_);
+    }
+
+    [[nodiscard]] constexpr auto col(std::size_t index) const -> MatrixView
+    {
+        return block(0, index, rows_, 1);
+    }
+
+    [[nodiscard]] constexpr auto transposed() const noexcept -> MatrixView
+    {
+        return { data_, cols_, rows_, col_stride_, row_stride_ };
+    }
+
+    // Owning copy of the viewed elements.
+    [[nodiscard]] auto to_matrix() const -> DynamicMatrix<T>
+    {
+        DynamicMatrix<T> result{ detail::uninitialized, rows_, cols_ };
+        if (is_contiguous()) {
+            std::copy_n(data_, rows_ * cols_, result.data());
+            return result;
+        }
+        for (std::size_t i = 0; i < rows_; ++i) {
+            for (std::size_t j = 0; j < cols_; ++j) {
+                result.data()[i * cols_ + j] =
+                    data_[i * row_stride_ + j * col_stride_];
+            }
+        }
+        return result;
+    }
+
+   private:
+    friend constexpr auto strided(const MatrixView& view) noexcept
+        -> detail::strided_view<T>
+    {
+        return { view.data_, view.row_stride_, view.col_stride_ };
+    }
+
+    const T* data_{ nullptr };
+    std::size_t rows_{ 0 };
+    std::size_t cols_{ 0 };
+    std::size_t row_stride_{ 0 };
+    std::size_t col_stride_{ 1 };
+};
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+MatrixView(const Matrix<T, I, J>&) -> MatrixView<T>;
+
+namespace detail {
+
+// Element (row, col) of an operand, read through its strides when it has
+// them rather than through a flat index.
+template <class M>
+constexpr auto element_at(const M& operand, std::size_t row, std::size_t col)
+{
+    if constexpr (StridedOperand<M>) {
+        const auto view = strided(operand);
+        return view.data[row * view.row_stride + col * view.col_stride];
+    }
+    else {
+        return operand.element(row * operand.col_size() + col);
+    }
+}
+
+}  // namespace detail
+
+// Writable counterpart of MatrixView, so that blocked and recursive
+// algorithms can work in place on part of a matrix. Copying a span copies
+// the reference; assigning to one writes through to the elements it refers
+// to and never rebinds it. The source of an assignment must not partially
+// overlap the span.
+template <detail::Arithmetic T>
+class MatrixSpan final {
+   public:
+    using value_type = T;
+    static constexpr std::size_t rows_extent = dynamic;
+    static constexpr std::size_t cols_extent = dynamic;
+    static constexpr bool fixed_shape = false;
+
+    constexpr MatrixSpan() noexcept = default;
+
+    constexpr MatrixSpan(
+        T* data,
+        std::size_t rows,
+        std::size_t cols,
+        std::size_t row_stride,
+        std::size_t col_stride) noexcept
+        : data_{ data },
+          rows_{ rows },
+          cols_{ cols },
+          row_stride_{ row_stride },
+          col_stride_{ col_stride }
+    {
+    }
+
+    template <std::size_t I, std::size_t J>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+    constexpr MatrixSpan(Matrix<T, I, J>& matrix) noexcept
+        : MatrixSpan(
+              matrix.data(),
+              matrix.row_size(),
+              matrix.col_size(),
+              matrix.col_size(),
+              1)
+    {
+    }
+
+    constexpr MatrixSpan(const MatrixSpan&) noexcept = default;
+
+    constexpr auto operator=(const MatrixSpan& other) -> MatrixSpan&
+    {
+        return *this = MatrixView<T>{ other };
+    }
+
+    template <detail::MatrixOperand E>
+        requires detail::SameShape<MatrixSpan, E>
+    constexpr auto operator=(const E& source) -> MatrixSpan&
+    {
+        update(execution::seq, source, [](T, auto value) {
+            return static_cast<T>(value);
+        });
+        return *this;
+    }
+
+    template <detail::MatrixOperand E>
+        requires detail::SameShape<MatrixSpan, E>
+    constexpr auto operator+=(const E& source) -> MatrixSpan&
+    {
+        update(execution::seq, source, [](T elem, auto value) {
+            return static_cast<T>(elem + value);
+        });
+        return *this;
+    }
+
+    template <detail::MatrixOperand E>
+        requires detail::SameShape<MatrixSpan, E>
+    constexpr auto operator-=(const E& source) -> MatrixSpan&
+    {
+        update(execution::seq, source, [](T elem, auto value) {
+            return static_cast<T>(elem - value);
+        });
+        return *this;
+    }
+
+    template <detail::Scalar<T> U>
+    constexpr auto operator*=(const U& factor) -> MatrixSpan&
+    {
+        for (std::size_t i = 0; i < rows_; ++i) {
+            for (std::size_t j = 0; j < cols_; ++j) {
+                auto& elem = data_[i * row_stride_ + j * col_stride_];
+                elem = static_cast<T>(elem * factor);
+            }
+        }
+        return *this;
+    }
+
+    constexpr auto fill(const T& value) -> MatrixSpan&
+    {
+        for (std::size_t i = 0; i < rows_; ++i) {
+            for (std::size_t j = 0; j < cols_; ++j) {
+                data_[i * row_stride_ + j * col_stride_] = value;
+            }
+        }
+        return *this;
+    }
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+    constexpr operator MatrixView<T>() const noexcept
+    {
+        return { data_, rows_, cols_, row_stride_, col_stride_ };
+    }
+
+    [[nodiscard]] constexpr auto row_size() const noexcept -> std::size_t
+    {
+        return rows_;
+    }
+
+    [[nodiscard]] constexpr auto col_size() const noexcept -> std::size_t
+    {
+        return cols_;
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+        return { rows_, cols_ };
+    }
+
+    [[nodiscard]] constexpr auto row_stride() const noexcept -> std::size_t
+    {
+        return row_stride_;
+    }
+
+    [[nodiscard]] constexpr auto col_stride() const noexcept -> std::size_t
+    {
+        return col_stride_;
+    }
+
+    [[nodiscard]] constexpr auto data() const noexcept -> T* { return data_; }
+
+    [[nodiscard]] constexpr auto operator()(
+        std::size_t row,
+        std::size_t col) const -> T&
+    {
+        detail::check_index(
+            row < rows_ and col < cols_,
+            "MatrixView: index out of range");
+        return unchecked(row, col);
+    }
+
+    [[nodiscard]] constexpr auto unchecked(
+        std::size_t row,
+        std::size_t col) const noexcept -> T&
+    {
+        return data_[row * row_stride_ + col * col_stride_];
+    }
+
+    [[nodiscard]] constexpr auto element(std::size_t index) const noexcept
+        -> T
+    {
+        return data_[index / cols_ * row_stride_ + index % cols_ * col_stride_];
+    }
+
+    [[nodiscard]] constexpr auto block(
+        std::size_t row,
+        std::size_t col,
+        std::size_t rows,
+        std::size_t cols) const -> MatrixSpan
+    {
+        detail::check_block(rows_, cols_, row, col, rows, cols);
+        return { data_ + row * row_stride_ + col * col_stride_,
+                 rows,
+                 cols,
+                 row_stride_,
+                 col_stride_ };
+    }
+
+    [[nodiscard]] constexpr auto row(std::size_t index) const -> MatrixSpan
+    {
+        return block(index, 0, 1, cols_);
+    }
+
+    [[nodiscard]] constexpr auto col(std::size_t index) const -> MatrixSpan
+    {
+        return block(0, index, rows_, 1);
+    }
+
+    [[nodiscard]] constexpr auto transposed() const noexcept -> MatrixSpan
+    {
+        return { data_, cols_, rows_, col_stride_, row_stride_ };
+    }
+
+    [[nodiscard]] auto to_matrix() const -> DynamicMatrix<T>
+    {
+        return MatrixView<T>{ *this }.to_matrix();
+    }
+
+    // Sets every element to op(element, source element), splitting the rows
+    // across the pool of `policy`.
+    template <execution::Policy P, detail::MatrixOperand E, class Op>
+    constexpr auto update(const P& policy, const E& source, Op op) const
+    {
+        detail::check_same_shape(*this, source);
+
+        const instrumentation::detail::scoped_operation operation{
+            instrumentation::kind::assign
+        };
+
+        detail::for_each_chunk(
+            policy,
+            rows_,
+            std::max<std::size_t>(
+                1,
+                detail::elementwise_grain / std::max<std::size_t>(cols_, 1)),
+            [this, &source, op](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    auto* row = data_ + i * row_stride_;
+                    for (std::size_t j = 0; j < cols_; ++j) {
+                        row[j * col_stride_] = op(
+                            row[j * col_stride_],
+                            detail::element_at(source, i, j));
+                    }
+                }
+            });
+    }
+
+   private:
+    friend constexpr auto strided(const MatrixSpan& span) noexcept
+        -> detail::strided_view<T>
+    {
+        return { span.data_, span.row_stride_, span.col_stride_ };
+    }
+
+    T* data_{ nullptr };
+    std::size_t rows_{ 0 };
+    std::size_t cols_{ 0 };
+    std::size_t row_stride_{ 0 };
+    std::size_t col_stride_{ 1 };
+};
+
+template <detail::Arithmetic T, std::size_t I, std::size_t J>
+MatrixSpan(Matrix<T, I, J>&) -> MatrixSpan<T>;
+
+namespace detail {
+
+template <class T>
+struct is_matrix_expression<MatrixView<T>> : std::true_type {};
+
+template <class T>
+struct is_matrix_expression<MatrixSpan<T>> : std::true_type {};
+
+template <class T, std::size_t I, std::size_t J>
+constexpr auto view_of(Matrix<T, I, J>& matrix) noexcept -> MatrixSpan<T>
+{
+    return matrix;
+}
+
+template <class T, std::size_t I, std::size_t J>
+constexpr auto view_of(const Matrix<T, I, J>& matrix) noexcept
+    -> MatrixView<T>
+{
+    return matrix;
+}
+
+template <class T>
+constexpr auto view_of(MatrixView<T> view) noexcept -> MatrixView<T>
+{
+    return view;
+}
+
+template <class T>
+constexpr auto view_of(MatrixSpan<T> span) noexcept -> MatrixSpan<T>
+{
+    return span;
+}
+
+// Matrices and views that blocks can be taken of. A temporary matrix is not
+// one, since the block would outlive it.
+template <class M>
+concept Viewable = requires(M& operand) { view_of(operand); }
+                   and not(is_matrix_v<M> and std::is_rvalue_reference_v<M&&>);
+
+}  // namespace detail
+
+// The rows x cols block of `operand` whose top-left element is (row, col),
+// as a MatrixSpan when the operand is writable and a MatrixView otherwise.
+template <class M>
+    requires detail::Viewable<M>
+[[nodiscard]] constexpr auto block(
+    M&& operand,
+    std::size_t row,
+    std::size_t col,
+    std::size_t rows,
+    std::size_t cols)
+{
+    return detail::view_of(operand).block(row, col, rows, cols);
+}
+
+template <class M>
+    requires detail::Viewable<M>
+[[nodiscard]] constexpr auto row(M&& operand, std::size_t index)
+{
+    return detail::view_of(operand).row(index);
+}
+
+template <class M>
+    requires detail::Viewable<M>
+[[nodiscard]] constexpr auto col(M&& operand, std::size_t index)
+{
+    return detail::view_of(operand).col(index);
+}
+
+// The transpose of a view is a view with its extents and strides swapped.
+template <detail::Arithmetic T>
+[[nodiscard]] constexpr auto transposed(MatrixView<T> view) noexcept
+    -> MatrixView<T>
+{
+    return view.transposed();
+}
+
+template <detail::Arithmetic T>
+[[nodiscard]] constexpr auto transposed(MatrixSpan<T> span) noexcept
+    -> MatrixSpan<T>
+{
+    return span.transposed();
+}
+
+// Evaluates `source` into the elements `destination` refers to.
+template <execution::Policy P, detail::Arithmetic T, detail::MatrixOperand E>
+    requires detail::SameShape<MatrixSpan<T>, E>
+constexpr auto assign(
+    const P& policy,
+    MatrixSpan<T> destination,
+    const E& source) -> MatrixSpan<T>
+{
+    destination.update(policy, source, [](T, auto value) {
+        return static_cast<T>(value);
+    });
+    return destination;
+}
+
+// Computes out = alpha * lhs * rhs + beta * out in the elements of `out`,
+// which must already have the shape of the product and must not share
+// elements with either operand. Blocks of one matrix can be multiplied into
+// another block of it.
+template <
+    class Acc = void,
+    execution::Policy P,
+    detail::Arithmetic T,
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<MatrixSpan<T>, L, R>
+constexpr auto gemm(
+    const P& policy,
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& alpha,
+    const L& lhs,
+    const R& rhs,
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& beta,
+    MatrixSpan<T> out) -> MatrixSpan<T>
+{
+    detail::check_multipliable(lhs, rhs);
+    if (out.row_size() != lhs.row_size() or out.col_size() != rhs.col_size()) {
+        throw std::logic_error{ "Matrix::invalid size" };
+    }
+    if (detail::shares_elements(out.data(), lhs)
+        or detail::shares_elements(out.data(), rhs)) {
+        throw std::logic_error{ "Matrix::output aliases an operand" };
+    }
+
+    const instrumentation::detail::scoped_operation operation{
+        instrumentation::kind::multiply,
+        2 * lhs.row_size() * rhs.col_size() * lhs.col_size()
+    };
+
+    using detail::strided;
+    const auto a = strided(lhs);
+    const auto b = strided(rhs);
+    const auto m = lhs.row_size();
+    const auto n = rhs.col_size();
+    const auto k = lhs.col_size();
+    // The kernel writes rows with unit stride; a column-major destination is
+    // filled as the row-major transpose, rhs' * lhs'.
+    if (out.col_stride() == 1 or n <= 1) {
+        detail::gemm(
+            policy,
+            m,
+            n,
+            k,
+            alpha,
+            a.data,
+            a.row_stride,
+            a.col_stride,
+            b.data,
+            b.row_stride,
+            b.col_stride,
+            beta,
+            out.data(),
+            out.row_stride());
+    }
+    else if (out.row_stride() == 1 or m <= 1) {
+        detail::gemm(
+            policy,
+            n,
+            m,
+            k,
+            alpha,
+            b.data,
+            b.col_stride,
+            b.row_stride,
+            a.data,
+            a.col_stride,
+            a.row_stride,
+            beta,
+            out.data(),
+            out.col_stride());
+    }
+    else {
+        auto result = out.to_matrix();
+        gemm<Acc>(policy, alpha, lhs, rhs, beta, result);
+        out = result;
+    }
+
+    return out;
+}
+
+template <
+    class Acc = void,
+    detail::Arithmetic T,
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<MatrixSpan<T>, L, R>
+constexpr auto gemm(
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& alpha,
+    const L& lhs,
+    const R& rhs,
+    const detail::accumulator_for_t<
+        Acc,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>& beta,
+    MatrixSpan<T> out) -> MatrixSpan<T>
+{
+    return gemm<Acc>(execution::seq, alpha, lhs, rhs, beta, out);
+}
+
+// Writes lhs * rhs into the elements of `out`, which must already have the
+// shape of the product.
+template <
+    execution::Policy P,
+    detail::Arithmetic T,
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<MatrixSpan<T>, L, R>
+constexpr auto multiply_into(
+    const P& policy,
+    MatrixSpan<T> out,
+    const L& lhs,
+    const R& rhs) -> MatrixSpan<T>
+{
+    using acc_type = detail::accumulator_for_t<
+        void,
+        T,
+        detail::operand_value_t<L>,
+        detail::operand_value_t<R>>;
+    return gemm(policy, acc_type{ 1 }, lhs, rhs, acc_type{}, out);
+}
+
+template <
+    detail::Arithmetic T,
+    detail::StridedOperand L,
+    detail::StridedOperand R>
+    requires detail::ProductInto<MatrixSpan<T>, L, R>
+constexpr auto multiply_into(MatrixSpan<T> out, const L& lhs, const R& rhs)
+    -> MatrixSpan<T>
+{
+    return multiply_into(execution::seq, out, lhs, rhs);
+}
+
+}  // namespace mtl
+
+#endif  // MTL_VIEW_HPP
@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+#include <async.hpp>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "helpers.hpp"
+
+TEST_CASE("Pool tasks")
+{
+    mtl::thread_pool pool{ 2 };
+
+    auto answer = pool.async([] { return 42; });
+    REQUIRE(answer.get() == 42);
+
+    auto failure = pool.async([] { throw std::runtime_error{ "task" }; });
+    REQUIRE_THROWS_AS(failure.get(), std::runtime_error);
+
+    // A task may split its own work across the pool it runs on.
+    auto total = pool.async([&pool] {
+        std::vector<int> hits(1000);
+        pool.parallel_for(hits.size(), 10, [&](std::size_t b, std::size_t e) {
+            for (auto i = b; i < e; ++i) { hits[i] = 1; }
+        });
+        int sum = 0;
+        for (const auto hit : hits) { sum += hit; }
+        return sum;
+    });
+    REQUIRE(total.get() == 1000);
+}
+
+TEST_CASE("Asynchronous products")
+{
+    mtl::thread_pool pool{ 3 };
+
+    auto lhs = test::seeded_matrix(120, 80, 4);
+    const auto rhs = test::seeded_matrix(80, 90, 5);
+    const auto expected = mtl::multiply(lhs, rhs);
+
+    // The operands are copied, so the caller may change them right away.
+    auto product = mtl::multiply_async(lhs, rhs);
+    lhs(0, 0) = 1000.0;
+    REQUIRE(product.get() == expected);
+
+    std::vector<std::future<mtl::DynamicMatrix<double>>> products;
+    for (int i = 0; i < 4; ++i) {
+        products.push_back(
+            mtl::multiply_async(
+                mtl::execution::on(pool),
+                test::seeded_matrix(120, 80, 4),
+                rhs));
+    }
+    for (auto& future : products) { REQUIRE(future.get() == expected); }
+
+    const mtl::Matrix<int, 2, 3> small{ 1, 2, 3, 4, 5, 6 };
+    const mtl::Matrix<int, 3, 1> column{ 1, 1, 1 };
+    auto fixed = mtl::multiply_async(small, column);
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(fixed.get()), mtl::Matrix<int, 2, 1>>);
+    REQUIRE(fixed.get() == mtl::Matrix<int, 2, 1>{ 6, 15 });
+
+    REQUIRE_THROWS_AS(mtl::multiply_async(rhs, rhs), std::logic_error);
+}
+
+TEST_CASE("Asynchronous expressions")
+{
+    const auto a = test::seeded_matrix(300, 200, 1);
+    const auto b = test::seeded_matrix(300, 200, 2);
+    const mtl::DynamicMatrix<double> expected = a + b * 2.0 - a;
+
+    auto sequential = mtl::evaluate_async(a + b * 2.0 - a);
+    auto parallel = mtl::evaluate_async(mtl::execution::par, a + b * 2.0 - a);
+    REQUIRE(sequential.get() == expected);
+    REQUIRE(parallel.get() == expected);
+
+    const mtl::Matrix<double, 2, 2> m{ 1, 2, 3, 4 };
+    auto doubled = mtl::evaluate_async(m + m);
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(doubled.get()), mtl::Matrix<double, 2, 2>>);
+    REQUIRE(doubled.get() == mtl::Matrix<double, 2, 2>{ 2, 4, 6, 8 });
+}
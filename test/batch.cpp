@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <batch.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+template <std::size_t I, std::size_t J>
+auto numbered_batch(std::size_t count) -> mtl::Batch<int, I, J>
+{
+    mtl::Batch<int, I, J> batch(count);
+    for (std::size_t b = 0; b < count; ++b) {
+        for (std::size_t i = 0; i < I; ++i) {
+            for (std::size_t j = 0; j < J; ++j) {
+                batch(b, i, j) = static_cast<int>((b + 1) * (i * J + j + 1));
+            }
+        }
+    }
+    return batch;
+}
+
+}  // namespace
+
+TEST_CASE("Batch storage")
+{
+    const mtl::Matrix<int, 2, 2> matrix{ 1, 2, 3, 4 };
+    mtl::Batch<int, 2, 2> batch{ 3, matrix };
+
+    REQUIRE(batch.size() == 3);
+    REQUIRE(batch.get(2) == matrix);
+    REQUIRE(batch.lane(0, 1).size() == 3);
+    REQUIRE(batch.lane(0, 1)[1] == 2);
+    REQUIRE(batch.data()[3] == 2);
+
+    batch.set(1, mtl::Matrix<int, 2, 2>{ 5, 6, 7, 8 });
+    REQUIRE(batch(1, 1, 0) == 7);
+    REQUIRE(batch.get(0) == matrix);
+    REQUIRE_THROWS_AS(batch.get(3), std::out_of_range);
+    REQUIRE_THROWS_AS(batch.lane(2, 0), std::out_of_range);
+
+    batch.resize(5);
+    REQUIRE(batch.get(1) == mtl::Matrix<int, 2, 2>{ 5, 6, 7, 8 });
+    REQUIRE(batch(4, 0, 0) == 0);
+    batch.resize(1);
+    REQUIRE(batch.get(0) == matrix);
+
+    const auto transposed = numbered_batch<2, 3>(4).transpose();
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(transposed), const mtl::Batch<int, 3, 2>>);
+    for (std::size_t b = 0; b < 4; ++b) {
+        REQUIRE(
+            transposed.get(b)
+            == numbered_batch<2, 3>(4).get(b).transpose());
+    }
+}
+
+TEST_CASE("Batch arithmetic")
+{
+    const auto lhs = numbered_batch<4, 4>(37);
+    const auto rhs = numbered_batch<4, 1>(37);
+    const auto product = lhs * rhs;
+    const auto parallel = mtl::multiply(mtl::execution::par, lhs, rhs);
+
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(product), const mtl::Batch<int, 4, 1>>);
+    REQUIRE(product == parallel);
+    for (std::size_t b = 0; b < lhs.size(); ++b) {
+        REQUIRE(product.get(b) == lhs.get(b) * rhs.get(b));
+    }
+    REQUIRE_THROWS_AS((lhs * numbered_batch<4, 1>(2)), std::logic_error);
+
+    const auto sum = lhs + lhs - lhs * 2 + 3 * lhs;
+    for (std::size_t b = 0; b < lhs.size(); ++b) {
+        REQUIRE(sum.get(b) == lhs.get(b) * 3);
+    }
+    REQUIRE_THROWS_AS((lhs + numbered_batch<4, 4>(1)), std::logic_error);
+}
+
+TEST_CASE("Batch determinant")
+{
+    mtl::Batch<double, 3, 3> small{ 2, mtl::Matrix<double, 3, 3>{} };
+    small.set(0, mtl::Matrix<double, 3, 3>{ 2, 1, 1, 4, -6, 0, -2, 7, 2 });
+    small.set(1, mtl::Matrix<double, 3, 3>{ 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+    const auto small_det = small.det();
+    REQUIRE(std::abs(small_det[0] + 16.0) < 1e-9);
+    REQUIRE(std::abs(small_det[1]) < 1e-9);
+
+    auto four = numbered_batch<4, 4>(3);
+    for (std::size_t b = 0; b < 3; ++b) {
+        for (std::size_t i = 0; i < 4; ++i) {
+            four(b, i, i) += static_cast<int>(i * i + b);
+        }
+    }
+    const auto four_det = four.det();
+    for (std::size_t b = 0; b < 3; ++b) {
+        REQUIRE(four_det[b] != 0.0);
+        REQUIRE(std::abs(four_det[b] - four.get(b).det()) < 1e-9);
+    }
+
+    const auto large = numbered_batch<5, 5>(3);
+    auto shifted = mtl::Batch<int, 5, 5>{ large };
+    for (std::size_t b = 0; b < 3; ++b) {
+        for (std::size_t i = 0; i < 5; ++i) { shifted(b, i, i) += 7; }
+    }
+    const auto large_det = shifted.det();
+    for (std::size_t b = 0; b < 3; ++b) {
+        const auto expected = shifted.get(b).det();
+        REQUIRE(std::abs(large_det[b] - expected) < 1e-6 * std::abs(expected));
+    }
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include <decomposition.hpp>
+#include <vector.hpp>
+#include <view.hpp>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "helpers.hpp"
+
+// Built with MTL_USE_BLAS when the MTL_USE_BLAS option is on: operands above
+// the dispatch threshold go to the library, and every result is compared
+// with a plain loop over the same elements.
+namespace {
+
+template <class L, class R>
+auto reference_product(const L& lhs, const R& rhs)
+    -> mtl::DynamicMatrix<double>
+{
+    mtl::DynamicMatrix<double> result(lhs.row_size(), rhs.col_size());
+    for (std::size_t i = 0; i < lhs.row_size(); ++i) {
+        for (std::size_t j = 0; j < rhs.col_size(); ++j) {
+            double sum = 0;
+            for (std::size_t p = 0; p < lhs.col_size(); ++p) {
+                sum += static_cast<double>(lhs(i, p))
+                       * static_cast<double>(rhs(p, j));
+            }
+            result(i, j) = sum;
+        }
+    }
+    return result;
+}
+
+template <class M>
+auto matches(const M& actual, const mtl::DynamicMatrix<double>& expected)
+    -> bool
+{
+    for (std::size_t i = 0; i < expected.row_size(); ++i) {
+        for (std::size_t j = 0; j < expected.col_size(); ++j) {
+            if (std::abs(static_cast<double>(actual(i, j)) - expected(i, j))
+                > 1e-6 * (1.0 + std::abs(expected(i, j)))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST_CASE("Large products")
+{
+    const auto a = test::seeded_matrix<double>(150, 90, 1);
+    const auto b = test::seeded_matrix<double>(90, 130, 2);
+    const auto expected = reference_product(a, b);
+
+    REQUIRE(matches(a * b, expected));
+    REQUIRE(matches(mtl::multiply(mtl::execution::par, a, b), expected));
+
+    // Transposed and strided operands are passed with a transpose flag or a
+    // leading dimension, or fall back to the built-in kernel.
+    const auto at = test::seeded_matrix<double>(90, 150, 1);
+    REQUIRE(matches(
+        mtl::transposed(at) * b,
+        reference_product(at.transpose(), b)));
+    const auto inner = mtl::block(b, 10, 20, 70, 100);
+    REQUIRE(matches(
+        mtl::block(a, 5, 0, 120, 70) * inner,
+        reference_product(mtl::block(a, 5, 0, 120, 70), inner)));
+
+    auto c = test::seeded_matrix<double>(150, 130, 3);
+    const auto before = c;
+    mtl::gemm(2.0, a, b, -1.0, c);
+    mtl::DynamicMatrix<double> combined(150, 130);
+    for (std::size_t i = 0; i < 150 * 130; ++i) {
+        combined.data()[i] = 2.0 * expected.data()[i] - before.data()[i];
+    }
+    REQUIRE(matches(c, combined));
+
+    const auto af = test::seeded_matrix<float>(100, 100, 4);
+    REQUIRE(matches(af * af, reference_product(af, af)));
+
+    // Integers and small operands never reach the library.
+    const auto ai = test::seeded_matrix<int>(100, 100, 5);
+    REQUIRE(matches(ai * ai, reference_product(ai, ai)));
+    const auto small = test::seeded_matrix<double>(4, 4, 6);
+    REQUIRE(matches(small * small, reference_product(small, small)));
+}
+
+TEST_CASE("Large matrix-vector products")
+{
+    const auto a = test::seeded_matrix<double>(200, 170, 7);
+    mtl::DynamicVector<double> x(170);
+    for (std::size_t i = 0; i < 170; ++i) {
+        x[i] = static_cast<double>(i % 5);
+    }
+
+    std::vector<double> expected(200);
+    for (std::size_t i = 0; i < 200; ++i) {
+        for (std::size_t j = 0; j < 170; ++j) {
+            expected[i] += a(i, j) * x[j];
+        }
+    }
+
+    const auto y = a * x;
+    for (std::size_t i = 0; i < 200; ++i) { REQUIRE(y[i] == expected[i]); }
+
+    const auto at = a.transpose();
+    std::vector<double> z(200, 1.0);
+    mtl::gemv(1.0, mtl::transposed(at), x, 2.0, z);
+    for (std::size_t i = 0; i < 200; ++i) {
+        REQUIRE(z[i] == expected[i] + 2.0);
+    }
+}
+
+TEST_CASE("Large factorizations")
+{
+    constexpr std::size_t n = 120;
+    auto spd = test::seeded_matrix<double>(n, n, 8);
+    spd = spd * mtl::transposed(spd);
+    for (std::size_t i = 0; i < n; ++i) {
+        spd(i, i) += static_cast<double>(n);
+    }
+
+    const mtl::Cholesky<double, mtl::dynamic> cholesky{ spd };
+    const auto& lower = cholesky.lower();
+    REQUIRE(lower.is_lower_triangular());
+    REQUIRE(matches(lower * mtl::transposed(lower), spd));
+
+    const mtl::DynamicMatrix<double> general =
+        test::seeded_matrix<double>(n, n, 9) + spd;
+    const mtl::LU<double, mtl::dynamic> lu{ general };
+    const auto x = lu.solve(mtl::DynamicMatrix<double>(n, 1, 1.0));
+    const auto residual = general * x;
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(std::abs(residual(i, 0) - 1.0) < 1e-9);
+    }
+
+    // Blocks {{2, 1}, {1, 2}} down the diagonal: the determinant is 3^(n/2).
+    mtl::DynamicMatrix<double> blocks(n, n);
+    for (std::size_t i = 0; i < n; i += 2) {
+        blocks(i, i) = blocks(i + 1, i + 1) = 2.0;
+        blocks(i, i + 1) = blocks(i + 1, i) = 1.0;
+    }
+    const auto expected = std::pow(3.0, static_cast<double>(n / 2));
+    REQUIRE(std::abs(blocks.det() / expected - 1.0) < 1e-12);
+    const mtl::LU<double, mtl::dynamic> factors{ blocks };
+    REQUIRE(std::abs(factors.det() / expected - 1.0) < 1e-12);
+
+    auto indefinite = spd;
+    indefinite(0, 0) = -1.0;
+    REQUIRE_THROWS_AS(
+        (mtl::Cholesky<double, mtl::dynamic>{ indefinite }),
+        std::domain_error);
+}
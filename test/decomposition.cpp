@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <decomposition.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+constexpr double tolerance = 1e-9;
+
+template <class L, class R>
+auto approx_equal(const L& lhs, const R& rhs) -> bool
+{
+    if (lhs.size() != rhs.size()) { return false; }
+    for (std::size_t i = 0; i < lhs.row_size() * lhs.col_size(); ++i) {
+        if (std::abs(lhs.data()[i] - rhs.data()[i]) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST_CASE("LU decomposition")
+{
+    const mtl::Matrix<int, 3, 3> matrix{ 2, 1, 1, 4, -6, 0, -2, 7, 2 };
+    const mtl::LU lu{ matrix };
+
+    STATIC_REQUIRE(std::is_same_v<decltype(lu)::value_type, double>);
+    REQUIRE(lu.size() == 3);
+    REQUIRE_FALSE(lu.is_singular());
+    REQUIRE(std::abs(lu.det() - (-16.0)) < tolerance);
+
+    SECTION("Partial pivoting picks the largest pivot")
+    {
+        REQUIRE(lu.pivots().front() == 1);
+        REQUIRE(lu.factors()(0, 0) == 4);
+    }
+
+    SECTION("Single and multiple right-hand sides")
+    {
+        const mtl::Matrix<double, 3, 1> rhs{ 5, -2, 9 };
+        const auto x = lu.solve(rhs);
+        REQUIRE(approx_equal(x, mtl::Matrix<double, 3, 1>{ 1, 1, 2 }));
+
+        const mtl::Matrix<double, 3, 2> both{ 5, 4, -2, 4, 9, 5 };
+        const auto xs = lu.solve(both);
+        REQUIRE(approx_equal(matrix * xs, both));
+    }
+
+    SECTION("Inverse")
+    {
+        REQUIRE(approx_equal(
+            matrix * lu.inverse(),
+            mtl::Matrix<double, 3, 3>{ 1, 0, 0, 0, 1, 0, 0, 0, 1 }));
+    }
+
+    SECTION("Dynamic matrix and parallel factorization")
+    {
+        mtl::DynamicMatrix<double> big(64, 64);
+        for (std::size_t i = 0; i < 64; ++i) {
+            for (std::size_t j = 0; j < 64; ++j) {
+                big(i, j) = 1.0 / static_cast<double>(i + j + 1)
+                            + (i == j ? 64.0 : 0.0);
+            }
+        }
+
+        const mtl::LU sequential{ big };
+        const mtl::LU parallel{ mtl::execution::par, big };
+        REQUIRE(std::abs(sequential.det() - parallel.det())
+                <= 1e-9 * std::abs(sequential.det()));
+
+        const mtl::DynamicMatrix<double> rhs(64, 3, 1.0);
+        REQUIRE(approx_equal(big * sequential.solve(rhs), rhs));
+    }
+
+    SECTION("Singular matrix")
+    {
+        const mtl::Matrix<double, 2, 2> singular{ 1, 2, 2, 4 };
+        const mtl::LU factorization{ singular };
+        REQUIRE(factorization.is_singular());
+        REQUIRE(factorization.det() == 0);
+        REQUIRE_THROWS_AS(factorization.inverse(), std::domain_error);
+    }
+
+    SECTION("Invalid sizes")
+    {
+        REQUIRE_THROWS_AS(
+            mtl::LU{ mtl::DynamicMatrix<double>(2, 3) },
+            std::logic_error);
+        REQUIRE_THROWS_AS(
+            lu.solve(mtl::DynamicMatrix<double>(2, 1)),
+            std::logic_error);
+    }
+}
+
+TEST_CASE("Cholesky decomposition")
+{
+    const mtl::Matrix<double, 3, 3> matrix{ { 4, 12, -16 },
+                                            { 12, 37, -43 },
+                                            { -16, -43, 98 } };
+    const mtl::Cholesky cholesky{ matrix };
+
+    REQUIRE(approx_equal(
+        cholesky.lower(),
+        mtl::Matrix<double, 3, 3>{ 2, 0, 0, 6, 1, 0, -8, 5, 3 }));
+    REQUIRE(std::abs(cholesky.det() - 36.0) < tolerance);
+
+    const mtl::Matrix<double, 3, 2> rhs{ 1, 0, 2, 1, 3, 0 };
+    REQUIRE(approx_equal(matrix * cholesky.solve(rhs), rhs));
+    REQUIRE(approx_equal(
+        matrix * cholesky.inverse(),
+        mtl::Matrix<double, 3, 3>{ 1, 0, 0, 0, 1, 0, 0, 0, 1 }));
+
+    const mtl::Matrix<double, 2, 2> indefinite{ 1, 2, 2, 1 };
+    REQUIRE_THROWS_AS(mtl::Cholesky{ indefinite }, std::domain_error);
+}
+
+TEST_CASE("QR decomposition")
+{
+    SECTION("Square system")
+    {
+        const mtl::Matrix<double, 3, 3> matrix{ { 12, -51, 4 },
+                                                { 6, 167, -68 },
+                                                { -4, 24, -41 } };
+        const mtl::QR qr{ matrix };
+
+        REQUIRE(approx_equal(qr.q() * qr.r(), matrix));
+        REQUIRE(approx_equal(
+            qr.q().transpose() * qr.q(),
+            mtl::Matrix<double, 3, 3>{ 1, 0, 0, 0, 1, 0, 0, 0, 1 }));
+        REQUIRE(std::abs(qr.det() - matrix.det()) < 1e-6);
+
+        const mtl::Matrix<double, 3, 1> rhs{ 1, 2, 3 };
+        REQUIRE(approx_equal(matrix * qr.solve(rhs), rhs));
+        REQUIRE(approx_equal(qr.inverse(), mtl::LU{ matrix }.inverse()));
+    }
+
+    SECTION("Least squares")
+    {
+        // Fit y = 1 + 2x through noiseless samples.
+        const mtl::Matrix<double, 4, 2> design{ 1, 0, 1, 1, 1, 2, 1, 3 };
+        const mtl::Matrix<double, 4, 1> samples{ 1, 3, 5, 7 };
+        const mtl::QR qr{ design };
+
+        REQUIRE(approx_equal(
+            qr.solve(samples),
+            mtl::Matrix<double, 2, 1>{ 1, 2 }));
+        REQUIRE_THROWS_AS(qr.det(), std::logic_error);
+    }
+
+    SECTION("Invalid sizes")
+    {
+        REQUIRE_THROWS_AS(
+            mtl::QR{ mtl::DynamicMatrix<double>(2, 3) },
+            std::logic_error);
+
+        const mtl::Matrix<double, 2, 2> rank_deficient{ 1, 2, 0, 0 };
+        const mtl::QR qr{ rank_deficient };
+        REQUIRE_THROWS_AS(qr.inverse(), std::domain_error);
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef MTL_TEST_HELPERS_HPP
+#define MTL_TEST_HELPERS_HPP
+
+#include <matrix.hpp>
+#include <cstddef>
+
+// Matrices shared by the test files.
+namespace test {
+
+// rows x cols matrix holding 0, 1, 2, ... in row-major order.
+template <class T = int>
+auto iota_matrix(std::size_t rows, std::size_t cols) -> mtl::DynamicMatrix<T>
+{
+    mtl::DynamicMatrix<T> result(rows, cols);
+    for (std::size_t i = 0; i < rows * cols; ++i) {
+        result.data()[i] = static_cast<T>(i);
+    }
+    return result;
+}
+
+// rows x cols matrix of integers in [-9, 9], a pattern that `seed` shifts.
+// Products and sums of such matrices are exact in floating point. Fixed
+// extents give a heap-backed matrix reallocated to rows x cols.
+template <class T = double, std::size_t I = mtl::dynamic, std::size_t J = I>
+auto seeded_matrix(std::size_t rows, std::size_t cols, std::size_t seed)
+    -> mtl::Matrix<T, I, J>
+{
+    mtl::Matrix<T, I, J> matrix;
+    if constexpr (I == mtl::dynamic) { matrix.resize(rows, cols); }
+    else {
+        matrix.realloc(rows, cols);
+    }
+    for (std::size_t i = 0; i < rows * cols; ++i) {
+        matrix.data()[i] = static_cast<T>((i * 7 + seed) % 19) - T{ 9 };
+    }
+    return matrix;
+}
+
+}  // namespace test
+
+#endif  // MTL_TEST_HELPERS_HPP
@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+#include <matrix.hpp>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+class recording_sink final : public mtl::instrumentation::sink {
+   public:
+    auto record(const mtl::instrumentation::event& event) noexcept
+        -> void override
+    {
+        const std::lock_guard lock{ mutex_ };
+        events_.push_back(event);
+    }
+
+    [[nodiscard]] auto count(mtl::instrumentation::kind kind) -> std::size_t
+    {
+        const std::lock_guard lock{ mutex_ };
+        std::size_t total = 0;
+        for (const auto& event : events_) {
+            if (event.kind == kind) { ++total; }
+        }
+        return total;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::vector<mtl::instrumentation::event> events_;
+};
+
+auto index(mtl::instrumentation::kind kind) -> std::size_t
+{
+    return static_cast<std::size_t>(kind);
+}
+
+}  // namespace
+
+TEST_CASE("Instrumentation counters")
+{
+    using mtl::instrumentation::kind;
+    STATIC_REQUIRE(mtl::instrumentation::enabled);
+
+    mtl::instrumentation::reset();
+    {
+        const mtl::DynamicMatrix<double> lhs(8, 4, 1.0);
+        const mtl::DynamicMatrix<double> rhs(4, 2, 1.0);
+        const auto product = lhs * rhs;
+        REQUIRE(product(0, 0) == 4.0);
+
+        const auto stats = mtl::instrumentation::snapshot();
+        REQUIRE(stats.allocations == 3);
+        REQUIRE(stats.deallocations == 0);
+        REQUIRE(stats.temporaries == 1);
+        REQUIRE(stats.flops == 2 * 8 * 2 * 4);
+        REQUIRE(stats.calls[index(kind::multiply)] == 1);
+    }
+
+    auto stats = mtl::instrumentation::snapshot();
+    REQUIRE(stats.deallocations == 3);
+    REQUIRE(stats.bytes_deallocated == stats.bytes_allocated);
+    REQUIRE(stats.bytes_allocated >= (32 + 8 + 16) * sizeof(double));
+
+    const mtl::Matrix<double, 3, 3> small{ 2, 1, 1, 4, -6, 0, -2, 7, 2 };
+    REQUIRE(small.det() == -16.0);
+    const auto row = small[1].get_row();
+    REQUIRE(row.size() == 3);
+    const auto transposed = small.transpose();
+
+    stats = mtl::instrumentation::snapshot();
+    REQUIRE(stats.calls[index(kind::det)] == 1);
+    REQUIRE(stats.calls[index(kind::transpose)] == 1);
+    REQUIRE(stats.temporaries == 3);
+    REQUIRE(stats.allocations == 3);
+
+    mtl::instrumentation::reset();
+    REQUIRE(mtl::instrumentation::snapshot().allocations == 0);
+    REQUIRE(mtl::instrumentation::snapshot().calls[index(kind::det)] == 0);
+}
+
+TEST_CASE("Instrumentation sink")
+{
+    using mtl::instrumentation::kind;
+
+    recording_sink sink;
+    mtl::instrumentation::set_sink(&sink);
+    {
+        mtl::DynamicMatrix<int> lhs(2, 2, 1);
+        const mtl::DynamicMatrix<int> rhs(2, 2, 2);
+        mtl::assign(mtl::execution::seq, lhs, lhs + rhs);
+        REQUIRE(lhs(1, 1) == 3);
+    }
+    mtl::instrumentation::set_sink(nullptr);
+
+    REQUIRE(sink.count(kind::allocation) == 2);
+    REQUIRE(sink.count(kind::deallocation) == 2);
+    REQUIRE(sink.count(kind::assign) == 1);
+
+    const mtl::DynamicMatrix<int> unobserved(2, 2);
+    REQUIRE(sink.count(kind::allocation) == 2);
+}
+
+TEST_CASE("Output parameters do not allocate")
+{
+    using mtl::instrumentation::kind;
+
+    const mtl::DynamicMatrix<double> lhs(40, 30, 1.0);
+    const mtl::DynamicMatrix<double> rhs(30, 40, 2.0);
+    mtl::DynamicMatrix<double> product(40, 40);
+    mtl::DynamicMatrix<double> transposed(40, 30);
+    mtl::DynamicMatrix<double> sum(40, 40);
+
+    mtl::instrumentation::reset();
+    for (int step = 0; step < 3; ++step) {
+        mtl::multiply_into(product, lhs, rhs);
+        mtl::gemm(0.5, lhs, rhs, 1.0, product);
+        mtl::transpose_into(transposed, rhs);
+        mtl::add_into(sum, product, product);
+        mtl::subtract_into(sum, sum, product);
+    }
+    REQUIRE(product(39, 39) == 90.0);
+    REQUIRE(sum(0, 0) == 90.0);
+
+    const auto stats = mtl::instrumentation::snapshot();
+    REQUIRE(stats.allocations == 0);
+    REQUIRE(stats.temporaries == 0);
+    REQUIRE(stats.calls[index(kind::multiply)] == 6);
+}
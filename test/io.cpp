@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <io.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+TEST_CASE("Matrix views")
+{
+    const mtl::Matrix<int, 2, 3> source{ 1, 2, 3, 4, 5, 6 };
+    const mtl::MatrixView view{ source };
+
+    REQUIRE(view.size() == std::pair<std::size_t, std::size_t>{ 2, 3 });
+    REQUIRE(view.data() == source.data());
+    REQUIRE(view(1, 2) == 6);
+    REQUIRE_THROWS_AS(view(2, 0), std::out_of_range);
+    REQUIRE(view.to_matrix() == source);
+
+    const mtl::Matrix<int, 2, 3> doubled = view + source;
+    REQUIRE(doubled == (source * 2));
+
+    const mtl::Matrix<int, 3, 2> rhs{ 1, 0, 0, 1, 1, 1 };
+    REQUIRE((view * rhs) == (source * rhs));
+    REQUIRE((view * mtl::MatrixView{ rhs }) == (source * rhs));
+}
+
+TEST_CASE("Binary files")
+{
+    mtl::DynamicMatrix<double> source(17, 9);
+    for (std::size_t i = 0; i < 17 * 9; ++i) {
+        source.data()[i] = 1.0 / static_cast<double>(i + 3);
+    }
+
+    SECTION("Streams")
+    {
+        std::stringstream stream;
+        mtl::save(stream, source);
+        REQUIRE(stream.str().size() == 64 + 17 * 9 * sizeof(double));
+        REQUIRE(mtl::load<double>(stream) == source);
+
+        const mtl::Matrix<std::int16_t, 2, 2> small{ -1, 2, -3, 4 };
+        std::stringstream other;
+        mtl::save(other, small);
+        REQUIRE(mtl::load<std::int16_t>(other) == small);
+
+        // Narrow weights keep their two-byte elements on disk.
+        const mtl::Matrix<mtl::bfloat16, 1, 3> weights{ mtl::bfloat16{ 0.5F },
+                                                        mtl::bfloat16{ -2 },
+                                                        mtl::bfloat16{ 96 } };
+        std::stringstream narrow;
+        mtl::save(narrow, weights);
+        REQUIRE(narrow.str().size() == 64 + 3 * 2);
+        REQUIRE(mtl::load<mtl::bfloat16>(narrow) == weights);
+        narrow.seekg(0);
+        REQUIRE_THROWS_AS(mtl::load<std::int16_t>(narrow), std::runtime_error);
+
+#if defined(MTL_HAS_FLOAT16)
+        const mtl::Matrix<mtl::half, 2, 1> halves{ mtl::half{ 0.25F },
+                                                   mtl::half{ 3 } };
+        std::stringstream binary16;
+        mtl::save(binary16, halves);
+        REQUIRE(mtl::load<mtl::half>(binary16) == halves);
+        binary16.seekg(0);
+        REQUIRE_THROWS_AS(
+            mtl::load<mtl::bfloat16>(binary16),
+            std::runtime_error);
+#endif
+    }
+
+    SECTION("Malformed headers")
+    {
+        std::stringstream stream;
+        mtl::save(stream, source);
+        auto bytes = stream.str();
+
+        std::stringstream wrong_type{ bytes };
+        REQUIRE_THROWS_AS(mtl::load<float>(wrong_type), std::runtime_error);
+
+        std::stringstream truncated{ bytes.substr(0, bytes.size() - 1) };
+        REQUIRE_THROWS_AS(mtl::load<double>(truncated), std::runtime_error);
+
+        bytes[0] = 'X';
+        std::stringstream bad_magic{ bytes };
+        REQUIRE_THROWS_AS(mtl::load<double>(bad_magic), std::runtime_error);
+    }
+
+    SECTION("Files")
+    {
+        const auto path = std::filesystem::temp_directory_path()
+                          / "mtl_io_test.mtl";
+        mtl::save(path, source);
+        REQUIRE(mtl::load<double>(path) == source);
+
+#if defined(MTL_HAS_MMAP)
+        auto mapped = mtl::map_file<double>(path);
+        const auto view = mapped.view();
+        REQUIRE(view.size() == source.size());
+        REQUIRE(reinterpret_cast<std::uintptr_t>(view.data()) % 64 == 0);
+        REQUIRE(view.to_matrix() == source);
+        REQUIRE((view * source.transpose()) == (source * source.transpose()));
+
+        auto moved{ std::move(mapped) };
+        REQUIRE(moved.view().data() == view.data());
+        REQUIRE_THROWS_AS(mtl::map_file<float>(path), std::runtime_error);
+#endif
+
+        std::filesystem::remove(path);
+        REQUIRE_THROWS_AS(mtl::load<double>(path), std::runtime_error);
+    }
+}
@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <matrix.hpp>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+class counting_resource final : public std::pmr::memory_resource {
+   public:
+    std::size_t allocations{ 0 };
+    std::size_t deallocations{ 0 };
+
+   private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+        -> void override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    [[nodiscard]] auto do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept
+        -> bool override
+    {
+        return this == &other;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Memory resources")
+{
+    counting_resource counter;
+    REQUIRE(mtl::current_resource() == std::pmr::new_delete_resource());
+
+    {
+        const mtl::scoped_resource scope{ counter };
+        REQUIRE(mtl::current_resource() == &counter);
+
+        const mtl::Matrix<double, 5, 5> lhs(2.0);
+        const mtl::Matrix<double, 5, 5> rhs(3.0);
+        REQUIRE(counter.allocations == 2);
+
+        const auto product = lhs * rhs;
+        REQUIRE(product(0, 0) == 30.0);
+        const auto allocated = counter.allocations;
+        REQUIRE(allocated > 2);
+
+        const mtl::Matrix<int, 2, 2> small{ 1, 2, 3, 4 };
+        REQUIRE(counter.allocations == allocated);
+    }
+
+    REQUIRE(mtl::current_resource() == std::pmr::new_delete_resource());
+    REQUIRE(counter.deallocations == counter.allocations);
+
+    // A matrix keeps allocating from, and frees through, its first resource.
+    auto* escaped = [&counter] {
+        const mtl::scoped_resource scope{ counter };
+        return new mtl::DynamicMatrix<int>(10, 10);
+    }();
+    const auto allocated = counter.allocations;
+    escaped->resize(20, 20);
+    REQUIRE(counter.allocations == allocated + 1);
+    delete escaped;
+    REQUIRE(counter.deallocations == counter.allocations);
+}
+
+TEST_CASE("Arena")
+{
+    mtl::arena arena{ 4096 };
+
+    {
+        const mtl::scoped_resource scope{ arena };
+        const mtl::DynamicMatrix<double> first(10, 10, 1.0);
+        REQUIRE(arena.used() >= 100 * sizeof(double));
+        REQUIRE(reinterpret_cast<std::uintptr_t>(first.data()) % 64 == 0);
+
+        const mtl::DynamicMatrix<double> large(10, 60, 1.0);
+        REQUIRE(arena.reserved() > 4096);
+        REQUIRE((first * large) == mtl::DynamicMatrix<double>(10, 60, 10.0));
+    }
+
+    const auto reserved = arena.reserved();
+    arena.reset();
+    REQUIRE(arena.used() == 0);
+
+    {
+        const mtl::scoped_resource scope{ arena };
+        const mtl::DynamicMatrix<double> again(10, 10, 1.0);
+        REQUIRE(arena.used() > 0);
+    }
+    REQUIRE(arena.reserved() == reserved);
+
+    arena.release();
+    REQUIRE(arena.reserved() == 0);
+
+    auto& local = mtl::thread_arena();
+    REQUIRE(&local == &mtl::thread_arena());
+}
+
+TEST_CASE("Allocation counts")
+{
+    counting_resource counter;
+    const mtl::scoped_resource scope{ counter };
+
+    const mtl::Matrix<double, 5, 5> source(2.0);
+    mtl::Matrix<double, 5, 5> target(1.0);
+    REQUIRE(counter.allocations == 2);
+
+    // Copying into a matrix of the same shape reuses its block.
+    target = source;
+    target = mtl::Matrix<int, 5, 5>(3);
+    REQUIRE(counter.allocations == 3);
+    REQUIRE(counter.deallocations == 1);
+    REQUIRE(target(4, 4) == 3.0);
+
+    mtl::DynamicMatrix<double> runtime(10, 10);
+    const mtl::DynamicMatrix<double> smaller(5, 5, 1.0);
+    runtime = smaller;
+    REQUIRE(counter.allocations == 5);
+    REQUIRE(runtime.capacity() == 100);
+    REQUIRE(runtime == smaller);
+
+    // Moves steal the block and free the one they replace.
+    const auto before = counter.allocations;
+    auto moved{ std::move(target) };
+    REQUIRE(moved(0, 0) == 3.0);
+    REQUIRE(target.data() == nullptr);
+
+    mtl::Matrix<double, 5, 5> other(4.0);
+    const auto freed = counter.deallocations;
+    moved = std::move(other);
+    REQUIRE(counter.allocations == before + 1);
+    REQUIRE(counter.deallocations == freed + 1);
+    REQUIRE(moved(2, 2) == 4.0);
+
+    // Converting moves steal between fixed and runtime extents.
+    const auto* block = moved.data();
+    mtl::DynamicMatrix<double> widened{ std::move(moved) };
+    REQUIRE(widened.data() == block);
+    REQUIRE(widened.size() == std::pair<std::size_t, std::size_t>{ 5, 5 });
+    REQUIRE(widened.capacity() == 25);
+
+    mtl::Matrix<double, 5, 5> narrowed{ std::move(widened) };
+    REQUIRE(narrowed.data() == block);
+    REQUIRE(widened.data() == nullptr);
+
+    mtl::Matrix<float, 5, 5> converted{ std::move(narrowed) };
+    REQUIRE(converted(2, 2) == 4.0F);
+    REQUIRE(counter.allocations == before + 2);
+
+    REQUIRE_THROWS_AS(
+        (narrowed = mtl::DynamicMatrix<double>(4, 5)),
+        std::logic_error);
+}
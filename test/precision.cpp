@@ -0,0 +1,171 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+TEST_CASE("bfloat16")
+{
+    STATIC_REQUIRE(sizeof(mtl::bfloat16) == 2);
+    STATIC_REQUIRE(mtl::detail::Arithmetic<mtl::bfloat16>);
+    STATIC_REQUIRE(std::is_same_v<mtl::accumulator_t<mtl::bfloat16>, float>);
+    STATIC_REQUIRE(
+        std::is_same_v<mtl::accumulator_t<std::int8_t>, std::int32_t>);
+    STATIC_REQUIRE(std::is_same_v<mtl::accumulator_t<int, double>, double>);
+
+    REQUIRE(float{ mtl::bfloat16{ 1.5F } } == 1.5F);
+    REQUIRE(mtl::bfloat16{ -2 }.bits() == 0xC000);
+    // 1 + 2^-8 lies halfway between two bfloat16 values and rounds to even.
+    REQUIRE(float{ mtl::bfloat16{ 1.0F + 0x1p-8F } } == 1.0F);
+    REQUIRE(float{ mtl::bfloat16{ 1.0F + 0x1p-7F + 0x1p-8F } }
+            == 1.0F + 0x1p-6F);
+    REQUIRE(std::isnan(
+        float{ mtl::bfloat16{ std::numeric_limits<float>::quiet_NaN() } }));
+
+    mtl::bfloat16 value{ 3 };
+    value += 1.0F;
+    value *= 0.5F;
+    REQUIRE(value == mtl::bfloat16{ 2 });
+
+    // Elements are printed as the floats they convert to.
+    const mtl::Matrix<mtl::bfloat16, 1, 2> pair{ mtl::bfloat16{ 1.5F },
+                                                 mtl::bfloat16{ -2 } };
+    std::ostringstream stream;
+    stream << pair << pair[0];
+    REQUIRE(stream.str() == "1.5 -2 \n1.5 -2 ");
+}
+
+TEST_CASE("Low-precision products")
+{
+    // 256 + 300 * 1 cannot be accumulated in bfloat16, whose spacing at 256
+    // is 2; accumulated in float it is exact, and so is its rounding.
+    constexpr std::size_t depth = 301;
+    mtl::DynamicMatrix<mtl::bfloat16> lhs(40, depth, mtl::bfloat16{ 1 });
+    mtl::DynamicMatrix<mtl::bfloat16> rhs(depth, 24, mtl::bfloat16{ 1 });
+    for (std::size_t i = 0; i < 40; ++i) { lhs(i, 0) = mtl::bfloat16{ 256 }; }
+
+    const auto product = mtl::multiply(lhs, rhs);
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(product)::value_type, mtl::bfloat16>);
+    REQUIRE(float{ product(39, 23) } == 556.0F);
+
+    mtl::DynamicMatrix<float> wide;
+    mtl::multiply_into(wide, lhs, rhs);
+    REQUIRE(wide(0, 0) == 556.0F);
+
+    mtl::DynamicVector<mtl::bfloat16> x(depth, mtl::bfloat16{ 1 });
+    std::vector<float> y(40);
+    mtl::gemv(1.0F, lhs, x, 0.0F, y);
+    REQUIRE(y[39] == 556.0F);
+    REQUIRE(float{ (lhs * x)[0] } == 556.0F);
+
+    const mtl::Matrix<mtl::bfloat16, 2, 2> small{ mtl::bfloat16{ 1 },
+                                                  mtl::bfloat16{ 2 },
+                                                  mtl::bfloat16{ 3 },
+                                                  mtl::bfloat16{ 4 } };
+    const auto square = small * small;
+    REQUIRE(float{ square(1, 1) } == 22.0F);
+    const mtl::Matrix<mtl::bfloat16, 2, 2> sum = small + small;
+    REQUIRE(float{ sum(1, 0) } == 6.0F);
+}
+
+#if defined(MTL_HAS_FLOAT16)
+TEST_CASE("Half-precision products")
+{
+    constexpr std::size_t depth = 2051;
+    mtl::DynamicMatrix<mtl::half> lhs(3, depth, mtl::half{ 1 });
+    mtl::DynamicVector<mtl::half> x(depth, mtl::half{ 1 });
+
+    // Above 2048 consecutive integers are not representable in half.
+    std::vector<float> y(3);
+    mtl::gemv(mtl::execution::par, 1.0F, lhs, x, 0.0F, y);
+    REQUIRE(y[2] == static_cast<float>(depth));
+
+    mtl::DynamicVector<mtl::half> narrow(3);
+    mtl::gemv<mtl::half>(mtl::half{ 1 }, lhs, x, mtl::half{}, narrow);
+    REQUIRE(static_cast<float>(narrow[0]) == 2048.0F);
+
+    const mtl::Matrix<mtl::half, 2, 1> column{ mtl::half{ 0.25F },
+                                               mtl::half{ 3 } };
+    std::ostringstream stream;
+    stream << column;
+    REQUIRE(stream.str() == "0.25 \n3 \n");
+}
+#endif
+
+TEST_CASE("Widening kernels")
+{
+    using mtl::detail::simd::isa;
+
+    // Signs, subnormals and the largest finite values of both formats.
+    std::vector<mtl::bfloat16> brain(67, mtl::bfloat16{ 0.5F });
+    brain[1] = mtl::bfloat16{ -3.0F };
+    brain[40] = mtl::bfloat16{ 1e-40F };
+    brain[66] = mtl::bfloat16{ 3e38F };
+    const auto expected = mtl::detail::simd::widening_dot(
+        isa::scalar,
+        brain.data(),
+        brain.data(),
+        brain.size());
+
+#if defined(MTL_HAS_FLOAT16)
+    std::vector<mtl::half> halves(67, mtl::half{ 0.5F });
+    halves[1] = mtl::half{ -3.0F };
+    halves[40] = static_cast<mtl::half>(0x1p-24F);
+    halves[66] = mtl::half{ 65504.0F };
+    const auto expected_half = mtl::detail::simd::widening_dot(
+        isa::scalar,
+        halves.data(),
+        halves.data(),
+        halves.size());
+#endif
+
+    for (const auto level : { isa::avx2, isa::avx512, isa::neon }) {
+        if (not mtl::detail::simd::supports(level)) { continue; }
+        REQUIRE(
+            mtl::detail::simd::widening_dot(
+                level,
+                brain.data(),
+                brain.data(),
+                brain.size())
+            == expected);
+#if defined(MTL_HAS_FLOAT16)
+        REQUIRE(
+            mtl::detail::simd::widening_dot(
+                level,
+                halves.data(),
+                halves.data(),
+                halves.size())
+            == expected_half);
+#endif
+    }
+
+    const std::vector<mtl::bfloat16> infinite(64, mtl::bfloat16{ 1e39 });
+    REQUIRE(std::isinf(mtl::detail::simd::widening_dot(
+        infinite.data(),
+        infinite.data(),
+        infinite.size())));
+}
+
+TEST_CASE("Integer products with wide accumulators")
+{
+    const mtl::Matrix<std::int8_t, 2, 2> small{ 100, 100, 100, 100 };
+    mtl::Matrix<std::int32_t, 2, 2> exact;
+    mtl::multiply_into(exact, small, small);
+    REQUIRE(exact(0, 0) == 20000);
+
+    mtl::DynamicMatrix<std::int8_t> lhs(64, 64, std::int8_t{ 100 });
+    mtl::DynamicMatrix<std::int32_t> out;
+    mtl::multiply_into(out, lhs, lhs);
+    REQUIRE(out(63, 63) == 64 * 100 * 100);
+
+    mtl::gemm(1, lhs, lhs, -1, out);
+    REQUIRE(out(0, 0) == 0);
+
+    // Mixed operands are accumulated in their common type.
+    const mtl::Matrix<int, 1, 2> ints{ 1, 2 };
+    const mtl::Matrix<double, 2, 1> halves{ 0.5, 0.25 };
+    REQUIRE((ints * halves)(0, 0) == 1.0);
+}
@@ -0,0 +1,208 @@
+#include <catch2/catch_test_macros.hpp>
+#include <reduction.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "helpers.hpp"
+
+TEST_CASE("Sums and norms")
+{
+    const mtl::Matrix<double, 2, 3> small{ 1, -2, 3, -4, 5, -6 };
+    REQUIRE(mtl::sum(small) == -3.0);
+    REQUIRE(mtl::norm_fro(small) == std::sqrt(91.0));
+    REQUIRE(mtl::norm_inf(small) == 15.0);
+    REQUIRE(mtl::min(small) == -6.0);
+    REQUIRE(mtl::max(small) == 5.0);
+    REQUIRE(mtl::argmax(small) == std::pair<std::size_t, std::size_t>{ 1, 1 });
+    REQUIRE(mtl::argmin(small) == std::pair<std::size_t, std::size_t>{ 1, 2 });
+    REQUIRE(mtl::row_sums(small) == mtl::Vector<double, 2>{ 2, -5 });
+    REQUIRE(mtl::col_sums(small) == mtl::Vector<double, 3>{ -3, 3, -3 });
+
+    const mtl::Matrix<int, 3, 3> square{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    REQUIRE(mtl::trace(square) == 15);
+    REQUIRE(mtl::trace(mtl::transposed(square)) == 15);
+    REQUIRE(mtl::trace(square + square) == 30);
+    REQUIRE_THROWS_AS(mtl::trace(small), std::logic_error);
+
+    // Expressions are evaluated once, then reduced.
+    REQUIRE(mtl::sum(small - small) == 0.0);
+    REQUIRE(mtl::max(small * 2) == 10.0);
+
+    const mtl::DynamicMatrix<double> empty;
+    REQUIRE(mtl::sum(empty) == 0.0);
+    REQUIRE(mtl::norm_fro(empty) == 0.0);
+    REQUIRE(mtl::norm_inf(empty) == 0.0);
+    REQUIRE(mtl::row_sums(empty).empty());
+    REQUIRE_THROWS_AS(mtl::min(empty), std::logic_error);
+    REQUIRE_THROWS_AS(mtl::argmax(empty), std::logic_error);
+}
+
+TEST_CASE("Reductions of views")
+{
+    const auto source = test::iota_matrix(37, 53);
+    long expected = 0;
+    for (std::size_t i = 3; i < 30; ++i) {
+        for (std::size_t j = 5; j < 50; ++j) {
+            expected += source(i, j);
+        }
+    }
+
+    const auto middle = mtl::block(source, 3, 5, 27, 45);
+    REQUIRE(mtl::sum(middle) == expected);
+    REQUIRE(mtl::sum(mtl::transposed(middle)) == expected);
+    REQUIRE(
+        mtl::sum(mtl::transposed(source)) == 37 * 53 * (37 * 53 - 1) / 2);
+    REQUIRE(mtl::max(middle) == source(29, 49));
+    REQUIRE(mtl::min(mtl::col(source, 7)) == 7);
+    REQUIRE(mtl::sum(mtl::col(source, 7)) == 37 * 7 + 53 * 36 * 37 / 2);
+    REQUIRE(
+        mtl::argmin(mtl::transposed(middle))
+        == std::pair<std::size_t, std::size_t>{ 0, 0 });
+
+    const auto rows = mtl::row_sums(mtl::transposed(middle));
+    const auto cols = mtl::col_sums(middle);
+    REQUIRE(rows.size() == 45);
+    REQUIRE(rows == cols);
+    REQUIRE(mtl::col_sums(source)[0] == 53 * 36 * 37 / 2);
+
+    const mtl::Matrix<int, 2, 2> square{ 1, 2, 3, 4 };
+    REQUIRE(mtl::trace(mtl::block(source, 1, 1, 3, 3)) == 54 + 108 + 162);
+    REQUIRE(mtl::dot(square, mtl::transposed(square)) == 1 + 6 + 6 + 16);
+    const auto copy = middle.to_matrix();
+    REQUIRE(mtl::dot(middle, middle) == mtl::dot(copy, copy));
+    REQUIRE(mtl::dot(middle, copy) == mtl::dot(mtl::transposed(middle),
+                                               mtl::transposed(copy)));
+}
+
+TEST_CASE("Reductions do not depend on the thread count")
+{
+    // Large enough for many blocks, with values whose sum is sensitive to the
+    // order of the additions.
+    mtl::DynamicMatrix<double> values(301, 257);
+    for (std::size_t i = 0; i < values.row_size() * values.col_size(); ++i) {
+        values.data()[i] = 1.0 / static_cast<double>(i + 1)
+                           * (i % 3 == 0 ? -1e8 : 1.0);
+    }
+
+    const auto sum = mtl::sum(values);
+    const auto norm = mtl::norm_fro(values);
+    const auto inner =
+        mtl::dot(values, mtl::transposed(mtl::transposed(values)));
+    const auto rows = mtl::row_sums(values);
+    const auto cols = mtl::col_sums(values);
+    for (int repeat = 0; repeat < 4; ++repeat) {
+        REQUIRE(mtl::sum(mtl::execution::par, values) == sum);
+        REQUIRE(mtl::norm_fro(mtl::execution::par, values) == norm);
+        REQUIRE(mtl::dot(mtl::execution::par, values, values) == inner);
+        REQUIRE(mtl::row_sums(mtl::execution::par, values) == rows);
+        REQUIRE(mtl::col_sums(mtl::execution::par, values) == cols);
+        REQUIRE(mtl::max(mtl::execution::par, values) == mtl::max(values));
+        REQUIRE(
+            mtl::norm_inf(mtl::execution::par, values)
+            == mtl::norm_inf(values));
+    }
+
+    // Pairwise summation keeps a million ones and tenths accurate in float.
+    mtl::DynamicMatrix<float> tenths(1000, 1000, 0.1F);
+    REQUIRE(std::abs(mtl::sum(tenths) - 100000.0F) < 1.0F);
+}
+
+TEST_CASE("Reduction element types")
+{
+    mtl::DynamicMatrix<std::int8_t> bytes(64, 64, std::int8_t{ 100 });
+    STATIC_REQUIRE(std::is_same_v<decltype(mtl::sum(bytes)), std::int32_t>);
+    REQUIRE(mtl::sum(bytes) == 64 * 64 * 100);
+    REQUIRE(mtl::dot(bytes, bytes) == 64 * 64 * 100 * 100);
+    REQUIRE(mtl::norm_fro(bytes) == 6400.0);
+    bytes(5, 7) = -128;
+    REQUIRE(mtl::min(bytes) == -128);
+    REQUIRE(mtl::norm_inf(bytes) == 63 * 100 + 128);
+    REQUIRE(mtl::argmin(bytes) == std::pair<std::size_t, std::size_t>{ 5, 7 });
+
+    // Squares of integers are summed in double, past the range of int.
+    const mtl::DynamicMatrix<int> large(300, 200, 50000);
+    REQUIRE(
+        std::abs(mtl::norm_fro(large) - 50000.0 * std::sqrt(60000.0)) < 1e-6);
+    REQUIRE(
+        mtl::norm_fro(mtl::execution::par, large) == mtl::norm_fro(large));
+    REQUIRE(mtl::norm_fro(mtl::DynamicMatrix<int>(1, 1, 50000)) == 50000.0);
+
+    mtl::DynamicMatrix<mtl::bfloat16> brain(3, 301, mtl::bfloat16{ 1 });
+    brain(2, 0) = mtl::bfloat16{ 256 };
+    STATIC_REQUIRE(std::is_same_v<decltype(mtl::sum(brain)), float>);
+    REQUIRE(mtl::sum(brain) == 3.0F * 301.0F + 255.0F);
+    REQUIRE(mtl::dot(brain, brain) == 3.0F * 300.0F + 2.0F + 65536.0F);
+    REQUIRE(float{ mtl::max(brain) } == 256.0F);
+    REQUIRE(mtl::row_sums(brain)[2] == 556.0F);
+
+    const mtl::Matrix<std::uint8_t, 1, 3> unsigned_bytes{ 200, 200, 200 };
+    REQUIRE(mtl::sum(unsigned_bytes) == 600U);
+    REQUIRE(mtl::norm_inf(unsigned_bytes) == 600U);
+
+    // Mixed operands are accumulated in their common type.
+    const mtl::Matrix<int, 1, 2> ints{ 1, 2 };
+    const mtl::Matrix<double, 1, 2> halves{ 0.5, 0.25 };
+    REQUIRE(mtl::dot(ints, halves) == 1.0);
+}
+
+TEST_CASE("Dot products of vectors")
+{
+    const mtl::Vector<double, 3> x{ 1, 2, 3 };
+    const std::vector<double> y{ 4, 5, 6 };
+    REQUIRE(mtl::dot(x, y) == 32.0);
+    REQUIRE(mtl::dot(mtl::execution::par, y, x) == 32.0);
+
+    const std::vector<float> ones(10007, 1.0F);
+    REQUIRE(mtl::dot(ones, ones) == 10007.0F);
+    REQUIRE_THROWS_AS(mtl::dot(x, ones), std::logic_error);
+}
+
+TEST_CASE("Reduction kernels")
+{
+    using mtl::detail::simd::isa;
+    using mtl::detail::simd::reduction;
+
+    std::vector<double> doubles(131);
+    std::vector<std::int32_t> ints(131);
+    for (std::size_t i = 0; i < doubles.size(); ++i) {
+        doubles[i] = static_cast<double>((i * 37) % 101) - 50.0;
+        ints[i] = static_cast<std::int32_t>((i * 37) % 101) - 50;
+    }
+
+    for (const auto level : { isa::avx2, isa::avx512, isa::neon }) {
+        if (not mtl::detail::simd::supports(level)) { continue; }
+        for (const std::size_t count : { 1U, 7U, 64U, 131U }) {
+            const auto* d = doubles.data();
+            const auto* n = ints.data();
+            REQUIRE(
+                mtl::detail::simd::reduce<reduction::sum>(level, d, count)
+                == mtl::detail::simd::reduce_strided<reduction::sum>(
+                    d,
+                    count,
+                    1));
+            REQUIRE(
+                mtl::detail::simd::reduce<reduction::sum_abs>(level, n, count)
+                == mtl::detail::simd::reduce_strided<reduction::sum_abs>(
+                    n,
+                    count,
+                    1));
+            REQUIRE(
+                mtl::detail::simd::reduce<reduction::min>(level, d, count)
+                == mtl::detail::simd::reduce_strided<reduction::min>(
+                    d,
+                    count,
+                    1));
+            REQUIRE(
+                mtl::detail::simd::reduce<reduction::max>(level, n, count)
+                == mtl::detail::simd::reduce_strided<reduction::max>(
+                    n,
+                    count,
+                    1));
+        }
+    }
+}
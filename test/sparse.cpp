@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sparse.hpp>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Sparse construction")
+{
+    const mtl::CsrMatrix<int> csr{
+        3,
+        4,
+        { { 2, 1, 5 }, { 0, 3, 1 }, { 0, 0, 2 }, { 2, 1, 1 }, { 1, 2, 7 } }
+    };
+
+    REQUIRE(csr.size() == std::pair<std::size_t, std::size_t>{ 3, 4 });
+    REQUIRE(csr.nnz() == 4);
+    REQUIRE(
+        std::vector(csr.outer_starts().begin(), csr.outer_starts().end())
+        == std::vector<std::size_t>{ 0, 2, 3, 4 });
+    REQUIRE(
+        std::vector(csr.inner_indices().begin(), csr.inner_indices().end())
+        == std::vector<std::size_t>{ 0, 3, 2, 1 });
+    REQUIRE(csr.at(2, 1) == 6);
+    REQUIRE(csr.at(1, 1) == 0);
+    REQUIRE_THROWS_AS(csr.at(3, 0), std::out_of_range);
+
+    const mtl::Matrix<int, 3, 4> dense{ 2, 0, 0, 1, 0, 0, 7, 0, 0, 6, 0, 0 };
+    const auto unpacked = csr.to_dense();
+    REQUIRE(unpacked == dense);
+    REQUIRE(mtl::Matrix<int, 3, 4>{ unpacked } == dense);
+    REQUIRE(mtl::Matrix<int, 3, 4>{ csr.to_dense() } == dense);
+
+    const mtl::CscMatrix<int> csc{ dense };
+    REQUIRE(csc.nnz() == 4);
+    REQUIRE(csc.outer_size() == 4);
+    REQUIRE(csc.to_dense() == dense);
+    REQUIRE(mtl::CscMatrix<int>{ csr }.to_dense() == dense);
+    REQUIRE(mtl::CsrMatrix<double>{ csc }.at(1, 2) == 7.0);
+
+    REQUIRE_THROWS_AS(
+        (mtl::CsrMatrix<int>{ 2, 2, { { 2, 0, 1 } } }),
+        std::out_of_range);
+}
+
+TEST_CASE("Sparse transpose")
+{
+    const mtl::Matrix<int, 2, 3> dense{ 1, 0, 2, 0, 3, 0 };
+    const mtl::CsrMatrix<int> csr{ dense };
+    const auto transposed = csr.transpose();
+
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(transposed), const mtl::CscMatrix<int>>);
+    REQUIRE(transposed.size() == std::pair<std::size_t, std::size_t>{ 3, 2 });
+    REQUIRE(
+        transposed.to_dense()
+        == mtl::Matrix<int, 3, 2>{ 1, 0, 0, 3, 2, 0 });
+    REQUIRE(transposed.transpose().to_dense() == dense);
+
+    REQUIRE(
+        mtl::CsrMatrix<int>{ 3, 3, { { 0, 0, 1 }, { 2, 2, 4 } } }
+            .is_diagonal());
+    REQUIRE_FALSE(mtl::CsrMatrix<int>{ 3, 3, { { 0, 1, 1 } } }.is_diagonal());
+    REQUIRE_FALSE(csr.is_diagonal());
+}
+
+TEST_CASE("Sparse products")
+{
+    const mtl::Matrix<int, 3, 4> dense{ 2, 0, 0, 1, 0, 0, 7, 0, 0, 6, 0, 0 };
+    const mtl::Matrix<int, 4, 2> rhs{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    const auto expected = dense * rhs;
+
+    const mtl::CsrMatrix<int> csr{ dense };
+    const mtl::CscMatrix<int> csc{ dense };
+    REQUIRE(mtl::multiply(csr, rhs) == expected);
+    REQUIRE(mtl::multiply(csc, rhs) == expected);
+    REQUIRE(csr * rhs == expected);
+    REQUIRE(mtl::multiply(mtl::execution::par, csr, rhs) == expected);
+    REQUIRE_THROWS_AS(
+        mtl::multiply(csr, mtl::Matrix<int, 3, 2>{}),
+        std::logic_error);
+
+    const std::vector<int> x{ 1, 2, 3, 4 };
+    REQUIRE(mtl::multiply(csr, x) == std::vector<int>{ 6, 21, 12 });
+    REQUIRE(mtl::multiply(csc, x) == std::vector<int>{ 6, 21, 12 });
+    REQUIRE_THROWS_AS(
+        mtl::multiply(csr, std::vector<int>{ 1, 2 }),
+        std::logic_error);
+
+    mtl::DynamicMatrix<double> wide(300, 40, 1.0);
+    std::vector<mtl::triplet<double>> triplets;
+    for (std::size_t i = 0; i < 500; ++i) {
+        triplets.push_back({ i, (i * 7) % 300, 0.5 });
+    }
+    const mtl::CsrMatrix<double> band{ 500, 300, triplets };
+    REQUIRE(
+        mtl::multiply(mtl::execution::par, band, wide)
+        == mtl::multiply(band.to_dense(), wide));
+}
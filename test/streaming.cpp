@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+#include <streaming.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+
+#include "helpers.hpp"
+
+namespace {
+
+auto temporary(const char* name) -> std::filesystem::path
+{
+    return std::filesystem::temp_directory_path() / name;
+}
+
+}  // namespace
+
+TEST_CASE("File matrices")
+{
+    const auto path = temporary("mtl_streaming_blocks.mtl");
+    const auto source = test::seeded_matrix<int>(7, 5, 3);
+    mtl::save(path, source);
+
+    const mtl::FileMatrix<int> file{ path };
+    REQUIRE(file.size() == source.size());
+
+    mtl::DynamicMatrix<int> block(3, 2);
+    file.read(2, 1, 3, 2, block.data());
+    REQUIRE(block(0, 0) == source(2, 1));
+    REQUIRE(block(2, 1) == source(4, 2));
+    REQUIRE_THROWS_AS(
+        file.read(6, 0, 2, 2, block.data()),
+        std::out_of_range);
+
+    const mtl::Matrix<int, 2, 2> patch{ 100, 101, 102, 103 };
+    file.write(5, 3, 2, 2, patch.data());
+    const auto patched = mtl::load<int>(path);
+    REQUIRE(patched(6, 4) == 103);
+    REQUIRE(patched(6, 2) == source(6, 2));
+
+    REQUIRE_THROWS_AS(mtl::FileMatrix<float>{ path }, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Streaming operations")
+{
+    const auto lhs_path = temporary("mtl_streaming_lhs.mtl");
+    const auto rhs_path = temporary("mtl_streaming_rhs.mtl");
+    const auto out_path = temporary("mtl_streaming_out.mtl");
+
+    // A budget of five 16 x 16 tiles, so that every dimension needs several
+    // tiles and the last of them is partial.
+    const mtl::streaming_options options{ 5 * 16 * 16 * sizeof(double) };
+
+    SECTION("Multiply")
+    {
+        const auto lhs = test::seeded_matrix<double>(70, 45, 5);
+        const auto rhs = test::seeded_matrix<double>(45, 33, 11);
+        mtl::save(lhs_path, lhs);
+        mtl::save(rhs_path, rhs);
+
+        const mtl::FileMatrix<double> a{ lhs_path };
+        const mtl::FileMatrix<double> b{ rhs_path };
+        const auto product = mtl::multiply(a, b, out_path, options);
+        REQUIRE(product.row_size() == 70);
+        REQUIRE(product.col_size() == 33);
+        REQUIRE(mtl::load<double>(out_path) == lhs * rhs);
+
+        mtl::multiply(mtl::execution::par, a, b, out_path, options);
+        REQUIRE(mtl::load<double>(out_path) == lhs * rhs);
+
+        REQUIRE_THROWS_AS(
+            mtl::multiply(a, a, out_path, options),
+            std::logic_error);
+
+        // An operand is never truncated to make room for the result.
+        const auto square = test::seeded_matrix<double>(45, 45, 7);
+        mtl::save(rhs_path, square);
+        const mtl::FileMatrix<double> c{ rhs_path };
+        REQUIRE_THROWS_AS(
+            mtl::multiply(c, c, rhs_path, options),
+            std::logic_error);
+        REQUIRE(mtl::load<double>(rhs_path) == square);
+    }
+
+    SECTION("Element-wise")
+    {
+        const auto lhs = test::seeded_matrix<std::int32_t>(41, 29, 3);
+        const auto rhs = test::seeded_matrix<std::int32_t>(41, 29, 13);
+        mtl::save(lhs_path, lhs);
+        mtl::save(rhs_path, rhs);
+
+        const mtl::FileMatrix<std::int32_t> a{ lhs_path };
+        const mtl::FileMatrix<std::int32_t> b{ rhs_path };
+        const mtl::streaming_options small{ 1000 };
+
+        mtl::add(a, b, out_path, small);
+        REQUIRE(mtl::load<std::int32_t>(out_path) == lhs + rhs);
+
+        mtl::subtract(a, b, out_path, small);
+        REQUIRE(mtl::load<std::int32_t>(out_path) == lhs - rhs);
+
+        mtl::transform(
+            a,
+            b,
+            out_path,
+            [](std::int32_t x, std::int32_t y) { return x * y; },
+            small);
+        const auto product = mtl::load<std::int32_t>(out_path);
+        REQUIRE(product(40, 28) == lhs(40, 28) * rhs(40, 28));
+
+        const mtl::FileMatrix<std::int32_t> wrong =
+            mtl::FileMatrix<std::int32_t>::create(rhs_path, 29, 41);
+        REQUIRE_THROWS_AS(mtl::add(a, wrong, out_path), std::logic_error);
+
+        mtl::save(rhs_path, rhs);
+        REQUIRE_THROWS_AS(mtl::add(a, b, a.path()), std::logic_error);
+        const auto same = rhs_path.parent_path() / "." / rhs_path.filename();
+        REQUIRE_THROWS_AS(mtl::subtract(a, b, same), std::logic_error);
+        REQUIRE(mtl::load<std::int32_t>(lhs_path) == lhs);
+        REQUIRE(mtl::load<std::int32_t>(rhs_path) == rhs);
+    }
+
+    std::filesystem::remove(lhs_path);
+    std::filesystem::remove(rhs_path);
+    std::filesystem::remove(out_path);
+}
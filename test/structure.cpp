@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <structure.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("Structure queries")
+{
+    const mtl::Matrix<int, 3, 3> upper{ 1, 2, 3, 0, 4, 5, 0, 0, 6 };
+    REQUIRE(upper.is_upper_triangular());
+    REQUIRE_FALSE(upper.is_lower_triangular());
+    REQUIRE_FALSE(upper.is_diagonal());
+    REQUIRE_FALSE(upper.is_symmetric());
+    REQUIRE(upper.transpose().is_lower_triangular());
+
+    const mtl::Matrix<int, 3, 3> symmetric{ 1, 2, 3, 2, 4, 5, 3, 5, 6 };
+    REQUIRE(symmetric.is_symmetric());
+    REQUIRE_FALSE(symmetric.is_upper_triangular());
+
+    mtl::DynamicMatrix<double> identity(4, 4);
+    for (std::size_t i = 0; i < 4; ++i) { identity(i, i) = 1.0; }
+    REQUIRE(identity.is_identity());
+    REQUIRE(identity.is_diagonal());
+    REQUIRE(identity.is_symmetric());
+    identity(2, 2) = 3.0;
+    REQUIRE_FALSE(identity.is_identity());
+    REQUIRE(identity.is_diagonal());
+
+    const mtl::DynamicMatrix<int> wide(2, 3);
+    REQUIRE_FALSE(wide.is_upper_triangular());
+    REQUIRE_FALSE(wide.is_symmetric());
+}
+
+TEST_CASE("Triangular determinants")
+{
+    mtl::DynamicMatrix<double> lower(40, 40);
+    for (std::size_t i = 0; i < 40; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            lower(i, j) = i == j ? (i % 2 == 0 ? 2.0 : 0.5) : 7.0;
+        }
+    }
+    REQUIRE(lower.det() == 1.0);
+    lower(0, 0) = -3.0;
+    REQUIRE(lower.det() == -1.5);
+    REQUIRE(lower.transpose().det() == -1.5);
+
+    const mtl::Matrix<double, 4, 4> upper{ 2, 1, 1, 1, 0, 3, 1, 1,
+                                           0, 0, 4, 1, 0, 0, 0, 5 };
+    REQUIRE(upper.det() == 120.0);
+}
+
+TEST_CASE("Diagonal matrices")
+{
+    const mtl::DiagonalMatrix<double, 3> scale{ 1, 2, 3 };
+    STATIC_REQUIRE(mtl::detail::MatrixOperand<mtl::DiagonalMatrix<double, 3>>);
+    REQUIRE(scale(1, 1) == 2.0);
+    REQUIRE(scale(0, 2) == 0.0);
+    REQUIRE_THROWS_AS(scale(3, 0), std::out_of_range);
+    REQUIRE(scale.det() == 6.0);
+    REQUIRE_FALSE(scale.is_identity());
+    REQUIRE(mtl::DiagonalMatrix<int, 5>::identity().is_identity());
+
+    const mtl::Matrix<double, 3, 3> dense = scale;
+    REQUIRE(dense == mtl::Matrix<double, 3, 3>{ 1, 0, 0, 0, 2, 0, 0, 0, 3 });
+    REQUIRE(scale.to_matrix() == dense);
+    REQUIRE(
+        mtl::DiagonalMatrix<double, 3>{ dense }.diagonal()
+        == scale.diagonal());
+    REQUIRE_THROWS_AS(
+        (mtl::DiagonalMatrix<double, 3>{ mtl::Matrix<double, 3, 3>{ 0, 1 } }),
+        std::logic_error);
+
+    const mtl::Matrix<double, 3, 2> tall{ 1, 2, 3, 4, 5, 6 };
+    const auto rows = scale * tall;
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(rows), const mtl::Matrix<double, 3, 2>>);
+    REQUIRE(rows == mtl::Matrix<double, 3, 2>{ 1, 2, 6, 8, 15, 18 });
+    REQUIRE(
+        mtl::transposed(tall) * scale
+        == mtl::Matrix<double, 2, 3>{ 1, 6, 15, 2, 8, 18 });
+    REQUIRE((scale * (tall + tall))(2, 1) == 36.0);
+    REQUIRE((scale * scale).diagonal() == mtl::Vector<double, 3>{ 1, 4, 9 });
+    REQUIRE(
+        scale * mtl::Vector<double, 3>{ 1, 1, 1 }
+        == mtl::Vector<double, 3>{ 1, 2, 3 });
+    const mtl::Matrix<double, 3, 3> twice = scale + dense;
+    REQUIRE(twice(2, 2) == 6.0);
+
+    // Runtime-sized and parallel products agree with the dense product.
+    mtl::DynamicMatrix<float> values(300, 200);
+    for (std::size_t i = 0; i < 300 * 200; ++i) {
+        values.data()[i] = static_cast<float>(i % 13);
+    }
+    mtl::DynamicDiagonalMatrix<float> left(300, 2.0F);
+    left.diagonal()[7] = -1.0F;
+    const auto expected = left.to_matrix() * values;
+    REQUIRE(left * values == expected);
+    REQUIRE(mtl::multiply(mtl::execution::par, left, values) == expected);
+    REQUIRE(mtl::transposed(values) * left == expected.transpose());
+    REQUIRE_THROWS_AS(
+        (mtl::DynamicDiagonalMatrix<float>(3) * values),
+        std::logic_error);
+}
+
+TEST_CASE("Symmetric matrices")
+{
+    const mtl::Matrix<double, 3, 3> dense{ 4, 2, 1, 2, 5, 3, 1, 3, 6 };
+    mtl::SymmetricMatrix<double, 3> packed{ dense };
+    REQUIRE(packed.packed().size() == 6);
+    REQUIRE(packed(0, 2) == 1.0);
+    REQUIRE(packed(2, 0) == 1.0);
+    REQUIRE(packed.to_matrix() == dense);
+
+    packed(0, 1) = 7.0;
+    REQUIRE(packed(1, 0) == 7.0);
+    REQUIRE(packed.to_matrix().is_symmetric());
+    REQUIRE_THROWS_AS(packed(0, 3), std::out_of_range);
+
+    const mtl::Vector<double, 3> x{ 1, 2, 3 };
+    REQUIRE(packed * x == packed.to_matrix() * x);
+    REQUIRE(packed * dense == packed.to_matrix() * dense);
+    const mtl::Matrix<double, 3, 3> zero = packed - packed.to_matrix();
+    REQUIRE(zero.is_diagonal());
+
+    mtl::DynamicSymmetricMatrix<int> big(50);
+    for (std::size_t i = 0; i < 50; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            big(i, j) = static_cast<int>(i * 3 + j) % 11 - 5;
+        }
+    }
+    mtl::DynamicVector<int> y(50);
+    for (std::size_t i = 0; i < 50; ++i) { y[i] = static_cast<int>(i) - 20; }
+    REQUIRE(big * y == big.to_matrix() * y);
+    REQUIRE(mtl::DynamicSymmetricMatrix<int>{ big.to_matrix() } == big);
+    REQUIRE_THROWS_AS(
+        mtl::DynamicSymmetricMatrix<int>{ mtl::DynamicMatrix<int>(2, 3) },
+        std::logic_error);
+}
+
+TEST_CASE("Gram matrices")
+{
+    const mtl::Matrix<double, 4, 3> observations{ 1, 2, 3, 4, 5, 6,
+                                                  7, 8, 9, 1, 0, 1 };
+    const auto scatter = mtl::gram(observations);
+    STATIC_REQUIRE(
+        std::is_same_v<
+            decltype(scatter),
+            const mtl::SymmetricMatrix<double, 3>>);
+    REQUIRE(
+        scatter.to_matrix()
+        == mtl::transposed(observations) * observations);
+    REQUIRE(
+        mtl::gram(mtl::transposed(observations)).to_matrix()
+        == observations * mtl::transposed(observations));
+
+    const mtl::DynamicMatrix<std::int8_t> bytes(10, 4, std::int8_t{ 100 });
+    const auto wide = mtl::gram(bytes);
+    STATIC_REQUIRE(std::is_same_v<decltype(wide)::value_type, std::int32_t>);
+    REQUIRE(wide(3, 0) == 10 * 100 * 100);
+}
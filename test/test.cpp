@@ -1,6 +1,41 @@
+#include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <matrix.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace {
+
+template <class L, class R>
+concept addable = requires(const L& lhs, const R& rhs) { lhs + rhs; };
+
+template <class L, class R>
+concept subtractable = requires(const L& lhs, const R& rhs) { lhs - rhs; };
+
+template <class L, class R>
+concept add_assignable = requires(L& lhs, const R& rhs) { lhs += rhs; };
+
+template <class L, class R>
+concept sub_assignable = requires(L& lhs, const R& rhs) { lhs -= rhs; };
+
+template <class L, class R>
+concept assignable = requires(L& lhs, const R& rhs) { lhs = rhs; };
+
+template <class L, class R>
+concept multipliable = requires(const L& lhs, const R& rhs) { lhs * rhs; };
+
+template <class M>
+concept has_det = requires(const M& matrix) { matrix.det(); };
+
+template <class M>
+concept has_transpose_inplace =
+    requires(M& matrix) { matrix.transpose_inplace(); };
+
+}  // namespace
 
 TEST_CASE("Creating object - default constructor")
 {
@@ -10,7 +45,7 @@ TEST_CASE("Creating object - default constructor")
 
     SECTION("Allocation")
     {
-        REQUIRE(m1.underlying_array() != nullptr);
+        REQUIRE(m1.data() != nullptr);
         REQUIRE_FALSE(m1.is_reallocated());
     }
 
@@ -23,24 +58,26 @@ TEST_CASE("Creating object - default constructor")
 
     SECTION("Reallocation")
     {
-        constexpr std::size_t new_sg_size = 3;
-        m1.realloc(new_sg_size, new_sg_size);
+        constexpr std::size_t new_sg_size = 6;
+        mtl::Matrix<int, 5, 5> m2;
+        m2.realloc(new_sg_size, new_sg_size);
         std::pair<std::size_t, std::size_t> new_size = { new_sg_size,
                                                          new_sg_size };
-        REQUIRE(m1.size() == new_size);
-        REQUIRE(m1.row_size() == new_sg_size);
-        REQUIRE(m1.col_size() == new_sg_size);
+        REQUIRE(m2.size() == new_size);
+        REQUIRE(m2.row_size() == new_sg_size);
+        REQUIRE(m2.col_size() == new_sg_size);
     }
 }
 
 TEST_CASE("Underlying array")
 {
-    mtl::Matrix<int, 2, 2> matrix{};
+    mtl::Matrix<int, 4, 5> matrix{};
     const auto* underlying = matrix.underlying_array();
 
     REQUIRE(underlying != nullptr);
 
-    matrix = { 1, 2, 3, 4 };
+    matrix = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+               19, 20 };
 
     REQUIRE(underlying != nullptr);
 
@@ -51,17 +88,94 @@ TEST_CASE("Underlying array")
     }
 }
 
+TEST_CASE("Contiguous storage")
+{
+    mtl::Matrix<int, 4, 5> matrix;
+    std::iota(matrix.data(), matrix.data() + 20, 1);
+
+    SECTION("data")
+    {
+        const auto* data = matrix.data();
+        REQUIRE(data != nullptr);
+        REQUIRE(
+            reinterpret_cast<std::uintptr_t>(data) % alignof(std::max_align_t)
+            == 0);
+
+        for (int i = 0; i < 20; ++i) { REQUIRE(data[i] == i + 1); }
+    }
+
+    SECTION("span")
+    {
+        const auto span = matrix.span();
+        REQUIRE(span.size() == 20);
+        REQUIRE(span.data() == matrix.data());
+        REQUIRE(std::accumulate(span.begin(), span.end(), 0) == 210);
+    }
+
+    SECTION("underlying_array points into the same block")
+    {
+        const auto* underlying = matrix.underlying_array();
+        REQUIRE(underlying[0] == matrix.data());
+        REQUIRE(underlying[1] == matrix.data() + matrix.col_size());
+    }
+
+    SECTION("Reallocation keeps storage contiguous")
+    {
+        matrix.realloc(3, 4);
+        REQUIRE(matrix.span().size() == 12);
+        REQUIRE(matrix.underlying_array()[2] == matrix.data() + 8);
+    }
+}
+
+TEST_CASE("Inline storage")
+{
+    using small = mtl::Matrix<float, 4, 4>;
+    using large = mtl::Matrix<float, 5, 5>;
+
+    STATIC_REQUIRE(small::has_inline_storage);
+    STATIC_REQUIRE_FALSE(large::has_inline_storage);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<small>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<mtl::Matrix<double, 2, 2>>);
+    STATIC_REQUIRE_FALSE(std::is_trivially_copyable_v<large>);
+    STATIC_REQUIRE(sizeof(small) >= 16 * sizeof(float));
+
+    SECTION("Constant expressions")
+    {
+        constexpr auto make = []() {
+            mtl::Matrix<int, 2, 2> matrix{ 1, 2, 3, 4 };
+            matrix += mtl::Matrix<int, 2, 2>{ 1, 1, 1, 1 };
+            return matrix;
+        };
+
+        constexpr auto matrix = make();
+        STATIC_REQUIRE(matrix.at(0, 0) == 2);
+        STATIC_REQUIRE(matrix.at(1, 1) == 5);
+        STATIC_REQUIRE(matrix == mtl::Matrix<int, 2, 2>{ 2, 3, 4, 5 });
+    }
+
+    SECTION("Copy and move keep both objects valid")
+    {
+        small matrix(2.0F);
+        const small copy = matrix;
+        const small moved = std::move(matrix);
+
+        REQUIRE(copy == moved);
+        REQUIRE(copy.data() != moved.data());
+        REQUIRE(moved.size() == std::pair<std::size_t, std::size_t>{ 4, 4 });
+    }
+}
+
 TEST_CASE("Reallocation")
 {
-    constexpr std::size_t base_size = 2;
-    mtl::Matrix<int, base_size, base_size> m{ 1, 2, 3, 4 };
+    constexpr std::size_t base_size = 5;
+    mtl::Matrix<int, base_size, base_size> m(1);
 
     REQUIRE_FALSE(m.is_reallocated());
 
     REQUIRE(m.row_size() == base_size);
     REQUIRE(m.col_size() == base_size);
 
-    constexpr std::size_t new_size = 3;
+    constexpr std::size_t new_size = 6;
     m.realloc(new_size, new_size);
 
     REQUIRE(m.is_reallocated());
@@ -70,6 +184,97 @@ TEST_CASE("Reallocation")
     REQUIRE(m.col_size() == new_size);
 }
 
+TEST_CASE("Dynamic matrix")
+{
+    SECTION("Construction")
+    {
+        const mtl::DynamicMatrix<double> empty;
+        REQUIRE(empty.size() == std::pair<std::size_t, std::size_t>{ 0, 0 });
+        REQUIRE(empty.data() == nullptr);
+
+        const mtl::DynamicMatrix<double> filled(3, 4, 1.5);
+        REQUIRE(filled.size() == std::pair<std::size_t, std::size_t>{ 3, 4 });
+        REQUIRE(filled.capacity() == 12);
+        REQUIRE(std::all_of(filled.begin(), filled.end(), [](double elem) {
+            return elem == 1.5;
+        }));
+
+        const mtl::DynamicMatrix<int> nested{ { 1, 2, 3 }, { 4, 5, 6 } };
+        REQUIRE(nested.size() == std::pair<std::size_t, std::size_t>{ 2, 3 });
+        REQUIRE(nested(1, 0) == 4);
+        REQUIRE_FALSE(nested.is_reallocated());
+    }
+
+    SECTION("Resize keeps the top-left block")
+    {
+        mtl::DynamicMatrix<int> matrix{ { 1, 2, 3 }, { 4, 5, 6 } };
+        const auto* buffer = matrix.data();
+
+        matrix.resize(2, 2);
+        REQUIRE(matrix.data() == buffer);
+        REQUIRE(matrix == std::initializer_list<int>{ 1, 2, 4, 5 });
+
+        matrix.resize(2, 3);
+        REQUIRE(matrix.data() == buffer);
+        REQUIRE(matrix == std::initializer_list<int>{ 1, 2, 0, 4, 5, 0 });
+
+        matrix.resize(3, 3);
+        REQUIRE(matrix.capacity() == 9);
+        REQUIRE(
+            matrix
+            == std::initializer_list<int>{ 1, 2, 0, 4, 5, 0, 0, 0, 0 });
+        REQUIRE(matrix[2][1] == 0);
+    }
+
+    SECTION("Reserve")
+    {
+        mtl::DynamicMatrix<int> matrix(2, 2, 7);
+        matrix.reserve(10, 10);
+        REQUIRE(matrix.capacity() == 100);
+        REQUIRE(matrix == std::initializer_list<int>{ 7, 7, 7, 7 });
+
+        const auto* buffer = matrix.data();
+        matrix.resize(10, 10);
+        REQUIRE(matrix.data() == buffer);
+        REQUIRE(matrix(1, 1) == 7);
+        REQUIRE(matrix(9, 9) == 0);
+    }
+
+    SECTION("Operators")
+    {
+        const mtl::DynamicMatrix<double> lhs{ { 1, 2, 3 }, { 4, 5, 6 } };
+        const mtl::DynamicMatrix<double> rhs{ { 1, 0 }, { 0, 1 }, { 1, 1 } };
+        const mtl::Matrix<double, 2, 2> fixed{ 1, 2, 3, 4 };
+
+        const auto product = lhs * rhs;
+        REQUIRE(product == std::initializer_list<double>{ 4, 5, 10, 11 });
+
+        const auto mixed = product * fixed;
+        STATIC_REQUIRE(std::is_same_v<
+                       std::remove_const_t<decltype(mixed)>,
+                       mtl::DynamicMatrix<double>>);
+        REQUIRE(mixed == std::initializer_list<double>{ 19, 28, 43, 64 });
+
+        mtl::DynamicMatrix<double> sum;
+        sum = lhs + lhs * 2.0;
+        REQUIRE(sum.size() == lhs.size());
+        REQUIRE(sum == std::initializer_list<double>{ 3, 6, 9, 12, 15, 18 });
+
+        REQUIRE(lhs.transpose().size() == rhs.size());
+        REQUIRE(product.det() == 4 * 11 - 5 * 10);
+
+        auto copy = lhs;
+        copy *= rhs;
+        REQUIRE(copy == product);
+
+        const mtl::DynamicMatrix<double> converted(fixed);
+        REQUIRE(converted == fixed);
+
+        REQUIRE_THROWS_AS(lhs + rhs, std::logic_error);
+        REQUIRE_THROWS_AS(lhs * lhs, std::logic_error);
+    }
+}
+
 TEST_CASE("Creating object - big matrix size")
 {
     constexpr std::size_t size = 10000;
@@ -84,7 +289,7 @@ TEST_CASE("Creating object - fill with value")
     constexpr auto value_to_fill = 3;
     mtl::Matrix<int, sg_size, sg_size> m1(value_to_fill);
 
-    SECTION("Allocation") { REQUIRE(m1.underlying_array() != nullptr); }
+    SECTION("Allocation") { REQUIRE(m1.data() != nullptr); }
 
     SECTION("Size")
     {
@@ -114,7 +319,7 @@ TEST_CASE("Creating object - initializer list")
 
     const auto m1 = initialize_with_valid_list();
 
-    SECTION("Allocation") { REQUIRE(m1.underlying_array() != nullptr); }
+    SECTION("Allocation") { REQUIRE(m1.data() != nullptr); }
 
     constexpr auto initialize_with_invalid_list = []() {
         return mtl::Matrix<int, 2, 2>{ 1, 2, 3, 4, 5 };
@@ -146,7 +351,7 @@ TEST_CASE("Creating object - nested initializer list")
 
     const auto m1 = initialize_with_valid_list();
 
-    SECTION("Allocation") { REQUIRE(m1.underlying_array() != nullptr); }
+    SECTION("Allocation") { REQUIRE(m1.data() != nullptr); }
 
     constexpr auto initialize_with_invalid_list = []() {
         return mtl::Matrix<int, 3, 3>{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8 } };
@@ -197,13 +402,14 @@ TEST_CASE("Moving matrix")
 {
     SECTION("Move Constructor Moves Values Correctly")
     {
-        mtl::Matrix<int, 2, 3> matrix1{ 1, 2, 3, 4, 5, 6 };
-        mtl::Matrix<int, 2, 3> matrix2 = std::move(matrix1);
+        mtl::Matrix<int, 4, 5> matrix1;
+        std::iota(matrix1.data(), matrix1.data() + 20, 1);
+        mtl::Matrix<int, 4, 5> matrix2 = std::move(matrix1);
         REQUIRE(matrix1.underlying_array() == nullptr);
         REQUIRE(matrix2.underlying_array() != nullptr);
 
         constexpr std::pair<std::size_t, std::size_t> size_prev{ 0, 0 };
-        constexpr std::pair<std::size_t, std::size_t> size_val{ 2, 3 };
+        constexpr std::pair<std::size_t, std::size_t> size_val{ 4, 5 };
         REQUIRE(matrix1.size() == size_prev);
         REQUIRE(matrix2.size() == size_val);
 
@@ -303,7 +509,7 @@ TEST_CASE("operator[]")
         matrix[0] = new_row;
 
         REQUIRE(matrix[0].get_row() == new_row);
-        REQUIRE(matrix.underlying_array()[0][1] == new_row.at(1));
+        REQUIRE(matrix.data()[1] == new_row.at(1));
 
         std::initializer_list<int> row{ 0, 0, 3, 4 };
         REQUIRE(matrix == row);
@@ -315,6 +521,37 @@ TEST_CASE("operator[]")
         const std::vector<int> row{ 6, 7 };
         REQUIRE(matrix[1].get_row() == row);
     }
+
+    SECTION("Row is a view into the matrix")
+    {
+        mtl::Matrix<int, 2, 3> matrix{ 1, 2, 3, 4, 5, 6 };
+        const auto row = matrix[1];
+
+        REQUIRE(row.size() == 3);
+        REQUIRE(row.data() == matrix.data() + 3);
+
+        row[2] = 10;
+        REQUIRE(matrix(1, 2) == 10);
+
+        auto copy = row.get_row();
+        copy[0] = 0;
+        REQUIRE(matrix(1, 0) == 4);
+
+        int sum = 0;
+        for (const auto elem : matrix[0]) { sum += elem; }
+        REQUIRE(sum == 6);
+    }
+
+    SECTION("Crow is a view into the matrix")
+    {
+        const mtl::Matrix<int, 2, 3> matrix{ 1, 2, 3, 4, 5, 6 };
+        const auto row = matrix[0];
+
+        REQUIRE(row.size() == 3);
+        REQUIRE(row.data() == matrix.data());
+        REQUIRE(&row[1] == &matrix(0, 1));
+        REQUIRE_THROWS_AS(row[3], std::out_of_range);
+    }
 }
 
 TEST_CASE("operator[][]")
@@ -346,6 +583,28 @@ TEST_CASE("operator[][]")
     }
 }
 
+TEST_CASE("Checked and unchecked access")
+{
+    mtl::DynamicMatrix<int> matrix(2, 3);
+    const auto& view = matrix;
+
+    STATIC_REQUIRE(noexcept(matrix.unchecked(0, 0)));
+    STATIC_REQUIRE(noexcept(view.unchecked(0, 0)));
+
+    matrix.unchecked(1, 2) = 7;
+    REQUIRE(&view.unchecked(1, 2) == &matrix(1, 2));
+    REQUIRE(view.at(1, 2) == 7);
+
+    REQUIRE_THROWS_AS(matrix(2, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(view(0, 3), std::out_of_range);
+    REQUIRE_THROWS_AS(matrix[2], std::out_of_range);
+    REQUIRE_THROWS_AS(view.at(0, 3), std::out_of_range);
+
+    mtl::DynamicMatrix<int> empty;
+    REQUIRE_THROWS_AS(empty(0, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(empty.at(0, 0), std::out_of_range);
+}
+
 TEST_CASE("Range based for loop")
 {
     SECTION("Matrix")
@@ -370,9 +629,9 @@ TEST_CASE("Range based for loop")
 
     SECTION("With reallocation")
     {
-        mtl::Matrix<int, 2, 2> matrix{ 1, 2, 3, 4 };
+        mtl::Matrix<int, 4, 5> matrix(2);
 
-        matrix.realloc(3, 3);
+        matrix.realloc(5, 5);
         REQUIRE(matrix.is_reallocated());
         constexpr int value = 1;
         for (const auto elem : matrix) { REQUIRE(elem == value); }
@@ -446,6 +705,35 @@ TEST_CASE("Iterator - STL compatibility")
 
         REQUIRE(sum == 10);
     }
+
+    SECTION("Contiguous ranges")
+    {
+        STATIC_REQUIRE(
+            std::ranges::contiguous_range<mtl::Matrix<double, 3, 3>>);
+        STATIC_REQUIRE(std::ranges::contiguous_range<mtl::DynamicMatrix<int>>);
+        STATIC_REQUIRE(std::ranges::sized_range<const mtl::Matrix<int, 2, 2>>);
+        STATIC_REQUIRE(std::is_same_v<
+                       std::ranges::range_reference_t<
+                           const mtl::DynamicMatrix<float>>,
+                       const float&>);
+
+        mtl::DynamicMatrix<int> matrix(3, 4);
+        std::iota(matrix.begin(), matrix.end(), 0);
+        REQUIRE(matrix.begin() == matrix.data());
+        REQUIRE(std::ranges::size(matrix) == 12);
+        REQUIRE(matrix.end()[-1] == 11);
+        REQUIRE(matrix(2, 0) == 8);
+
+        std::ranges::sort(matrix, std::ranges::greater{});
+        REQUIRE(matrix(0, 0) == 11);
+        REQUIRE(std::reduce(matrix.cbegin(), matrix.cend()) == 66);
+
+        const std::span<const int> elements{ matrix };
+        REQUIRE(elements.size() == 12);
+
+        matrix.resize(2, 2);
+        REQUIRE(std::ranges::distance(matrix) == 4);
+    }
 }
 
 TEST_CASE("is diagonal")
@@ -481,6 +769,106 @@ TEST_CASE("Transposition")
         const mtl::Matrix<double, 2, 3> result{ { 1, 3, 5 }, { 2, 4, 6 } };
         REQUIRE(matrix.transpose() == result);
     }
+
+    SECTION("Blocked transposition")
+    {
+        mtl::DynamicMatrix<int> matrix(70, 45);
+        std::iota(matrix.data(), matrix.data() + 70 * 45, 0);
+
+        const auto result = matrix.transpose();
+        REQUIRE(
+            result.size() == std::pair<std::size_t, std::size_t>{ 45, 70 });
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < 70; ++i) {
+            for (std::size_t j = 0; j < 45; ++j) {
+                if (result(j, i) != matrix(i, j)) { ++mismatches; }
+            }
+        }
+        REQUIRE(mismatches == 0);
+        REQUIRE(result.transpose() == matrix);
+    }
+
+    SECTION("In-place transposition")
+    {
+        mtl::Matrix<int, 2, 2> small{ 1, 2, 3, 4 };
+        REQUIRE(
+            small.transpose_inplace()
+            == mtl::Matrix<int, 2, 2>{ 1, 3, 2, 4 });
+
+        mtl::DynamicMatrix<int> square(67, 67);
+        std::iota(square.data(), square.data() + 67 * 67, 0);
+        const auto expected = square.transpose();
+        REQUIRE(square.transpose_inplace() == expected);
+
+        STATIC_REQUIRE(has_transpose_inplace<mtl::Matrix<int, 3, 3>>);
+        STATIC_REQUIRE_FALSE(has_transpose_inplace<mtl::Matrix<int, 2, 3>>);
+        mtl::DynamicMatrix<int> wide(2, 3);
+        REQUIRE_THROWS_AS(wide.transpose_inplace(), std::logic_error);
+    }
+
+    SECTION("Lazy transposition")
+    {
+        const mtl::Matrix<double, 3, 2> matrix{ 1, 2, 3, 4, 5, 6 };
+        const auto view = mtl::transposed(matrix);
+        REQUIRE(view.row_size() == 2);
+        REQUIRE(view == matrix.transpose());
+        REQUIRE(
+            mtl::Matrix<double, 2, 3>{ view + view }
+            == matrix.transpose() * 2.0);
+
+        mtl::DynamicMatrix<double> lhs(40, 30);
+        mtl::DynamicMatrix<double> rhs(40, 20);
+        std::iota(lhs.data(), lhs.data() + 40 * 30, 0.0);
+        std::iota(rhs.data(), rhs.data() + 40 * 20, 1.0);
+
+        const auto product = mtl::transposed(lhs) * rhs;
+        STATIC_REQUIRE(std::is_same_v<
+                       std::remove_const_t<decltype(product)>,
+                       mtl::DynamicMatrix<double>>);
+        REQUIRE(product == lhs.transpose() * rhs);
+        const auto lhs_transpose = lhs.transpose();
+        REQUIRE(
+            mtl::multiply(mtl::execution::par, lhs_transpose, rhs)
+            == mtl::multiply(
+                mtl::execution::par,
+                mtl::transposed(lhs),
+                rhs));
+        REQUIRE(
+            mtl::multiply(mtl::transposed(rhs), mtl::transposed(lhs_transpose))
+            == product.transpose());
+        REQUIRE_THROWS_AS(
+            mtl::transposed(lhs) * lhs_transpose,
+            std::logic_error);
+    }
+
+    SECTION("Assigning the transpose of the destination")
+    {
+        mtl::Matrix<int, 3, 3> square{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        square = mtl::transposed(square);
+        REQUIRE(square == mtl::Matrix<int, 3, 3>{ 1, 4, 7, 2, 5, 8, 3, 6, 9 });
+
+        mtl::Matrix<int, 5, 5> sum;
+        std::iota(sum.begin(), sum.end(), 1);
+        const auto sum_transpose = sum.transpose();
+        const mtl::Matrix<int, 5, 5> expected_sum = sum_transpose + sum;
+        sum = mtl::transposed(sum) + sum;
+        REQUIRE(sum == expected_sum);
+
+        mtl::Matrix<int, 3, 3> twice{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        twice += mtl::transposed(twice);
+        REQUIRE(twice.is_symmetric());
+        REQUIRE(twice(0, 1) == 6);
+        mtl::assign(mtl::execution::par, twice, mtl::transposed(twice) * 2);
+        REQUIRE(twice(2, 0) == 20);
+
+        mtl::DynamicMatrix<int> wide(2, 3);
+        std::iota(wide.begin(), wide.end(), 1);
+        wide = mtl::transposed(wide);
+        REQUIRE(wide.row_size() == 3);
+        REQUIRE(wide.col_size() == 2);
+        const std::array<int, 6> wide_transpose{ 1, 4, 2, 5, 3, 6 };
+        REQUIRE(std::equal(wide.begin(), wide.end(), wide_transpose.begin()));
+    }
 }
 
 TEST_CASE("Determinant")
@@ -508,7 +896,9 @@ TEST_CASE("Determinant")
 
     SECTION("incorrect Matrix size")
     {
-        mtl::Matrix<int, 2, 3> matrix{};
+        STATIC_REQUIRE_FALSE(has_det<mtl::Matrix<int, 2, 3>>);
+
+        const mtl::DynamicMatrix<int> matrix(2, 3);
         REQUIRE_THROWS_AS(matrix.det(), std::logic_error);
     }
 }
@@ -526,6 +916,47 @@ TEST_CASE("Power")
     mtl::Matrix<int, 2, 2> matrix{ 1, 2, 3, 4 };
     const mtl::Matrix<int, 2, 2> result{ 7, 10, 15, 22 };
     REQUIRE(matrix.power(2) == result);
+
+    SECTION("Power 0 and 1")
+    {
+        REQUIRE(matrix.power(0) == std::initializer_list<int>{ 1, 0, 0, 1 });
+        REQUIRE(matrix.power(1) == matrix);
+
+        const mtl::DynamicMatrix<int> dynamic{ { 1, 2 }, { 3, 4 } };
+        REQUIRE(dynamic.power(0) == std::initializer_list<int>{ 1, 0, 0, 1 });
+    }
+
+    SECTION("Matches repeated multiplication")
+    {
+        mtl::Matrix<std::int64_t, 5, 5> heap;
+        for (std::size_t i = 0; i < 25; ++i) {
+            heap.data()[i] = static_cast<std::int64_t>(i % 3) - 1;
+        }
+
+        for (unsigned int power = 1; power <= 13; ++power) {
+            auto expected = heap;
+            for (unsigned int i = 1; i < power; ++i) { expected *= heap; }
+
+            REQUIRE(heap.power(power) == expected);
+        }
+    }
+
+    SECTION("Large powers")
+    {
+        const mtl::Matrix<std::uint64_t, 2, 2> fibonacci{ 1, 1, 1, 0 };
+        REQUIRE(fibonacci.power(90).at(0, 1) == 2880067194370816120ULL);
+
+        const mtl::DynamicMatrix<double> markov{ { 0.9, 0.1 }, { 0.5, 0.5 } };
+        const auto stationary = markov.power(4096);
+        REQUIRE(std::abs(stationary(0, 0) - 5.0 / 6.0) < 1e-12);
+        REQUIRE(std::abs(stationary(1, 1) - 1.0 / 6.0) < 1e-12);
+    }
+
+    SECTION("operator^")
+    {
+        matrix ^ 3;
+        REQUIRE(matrix == std::initializer_list<int>{ 37, 54, 81, 118 });
+    }
 }
 
 TEST_CASE("Addition")
@@ -541,9 +972,15 @@ TEST_CASE("Addition")
 
     SECTION("Addition Different Sizes")
     {
-        const mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
-        const mtl::Matrix<double, 3, 3> matrix2{ 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        using matrix1_type = mtl::Matrix<double, 2, 2>;
+        using matrix2_type = mtl::Matrix<double, 3, 3>;
 
+        STATIC_REQUIRE_FALSE(addable<matrix1_type, matrix2_type>);
+        STATIC_REQUIRE_FALSE(addable<mtl::Matrix<int, 5, 5>, matrix2_type>);
+
+        mtl::Matrix<double, 5, 5> matrix1;
+        matrix1.realloc(2, 2);
+        const mtl::Matrix<double, 5, 5> matrix2;
         REQUIRE_THROWS_AS(matrix1 + matrix2, std::logic_error);
     }
 
@@ -584,9 +1021,12 @@ TEST_CASE("Addition Assignment ")
 
     SECTION("Addition Assignment Different Sizes")
     {
-        mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
-        const mtl::Matrix<double, 3, 3> matrix2{ 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        STATIC_REQUIRE_FALSE(add_assignable<
+                             mtl::Matrix<double, 2, 2>,
+                             mtl::Matrix<double, 3, 3>>);
 
+        mtl::DynamicMatrix<double> matrix1(2, 2);
+        const mtl::Matrix<double, 3, 3> matrix2{ 2, 3, 4, 5, 6, 7, 8, 9, 10 };
         REQUIRE_THROWS_AS(matrix1 += matrix2, std::logic_error);
     }
 }
@@ -613,9 +1053,12 @@ TEST_CASE("Adjection")
 
     SECTION("Adjection Different Sizes")
     {
-        const mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
-        const mtl::Matrix<double, 3, 3> matrix2{ 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        STATIC_REQUIRE_FALSE(subtractable<
+                             mtl::Matrix<double, 2, 2>,
+                             mtl::Matrix<double, 3, 3>>);
 
+        const mtl::DynamicMatrix<double> matrix1(2, 2);
+        const mtl::Matrix<double, 3, 3> matrix2{ 2, 3, 4, 5, 6, 7, 8, 9, 10 };
         REQUIRE_THROWS_AS(matrix1 - matrix2, std::logic_error);
     }
 
@@ -652,9 +1095,12 @@ TEST_CASE("Subtraction and Subtraction Assignment")
 
     SECTION("Subtraction Different Sizes")
     {
-        const mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
-        const mtl::Matrix<double, 3, 3> matrix2{ 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        STATIC_REQUIRE_FALSE(subtractable<
+                             mtl::Matrix<double, 3, 3>,
+                             mtl::Matrix<double, 2, 2>>);
 
+        const mtl::Matrix<double, 3, 3> matrix1{ 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        const mtl::DynamicMatrix<double> matrix2(2, 2);
         REQUIRE_THROWS_AS(matrix1 - matrix2, std::logic_error);
     }
 }
@@ -685,9 +1131,12 @@ TEST_CASE("Subtraction Assignment")
 
     SECTION("Subtraction Assignment Different Sizes")
     {
-        mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
-        const mtl::Matrix<double, 3, 3> matrix2{ 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        STATIC_REQUIRE_FALSE(sub_assignable<
+                             mtl::Matrix<double, 2, 2>,
+                             mtl::Matrix<double, 3, 3>>);
 
+        mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
+        const mtl::DynamicMatrix<double> matrix2(3, 3, 1.0);
         REQUIRE_THROWS_AS(matrix1 -= matrix2, std::logic_error);
     }
 }
@@ -763,6 +1212,119 @@ TEST_CASE("Scalar Multiplication")
     }
 }
 
+TEST_CASE("Expression templates")
+{
+    const mtl::Matrix<double, 2, 2> matrix1{ 1, 2, 3, 4 };
+    const mtl::Matrix<double, 2, 2> matrix2{ 2, 3, 4, 5 };
+    const mtl::Matrix<int, 2, 2> matrix3{ 1, 1, 1, 1 };
+
+    SECTION("Operators build lazy expressions")
+    {
+        const auto expression = matrix1 + matrix2 * 2.0 - matrix3;
+        STATIC_REQUIRE(not mtl::detail::is_matrix_v<decltype(expression)>);
+        STATIC_REQUIRE(
+            mtl::detail::MatrixExpression<decltype(expression)>);
+
+        const mtl::Matrix<double, 2, 2> result = expression;
+        REQUIRE(result == std::initializer_list<double>{ 4, 7, 10, 13 });
+        REQUIRE(expression == result);
+        REQUIRE(result == expression);
+    }
+
+    SECTION("Scalar on the left does not modify the matrix")
+    {
+        const mtl::Matrix<double, 2, 2> result = 2.0 * matrix1;
+        REQUIRE(result == std::initializer_list<double>{ 2, 4, 6, 8 });
+        REQUIRE(matrix1 == std::initializer_list<double>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Assignment evaluates into the destination")
+    {
+        mtl::Matrix<double, 2, 2> matrix{ 1, 2, 3, 4 };
+        matrix = matrix + matrix2;
+        REQUIRE(matrix == std::initializer_list<double>{ 3, 5, 7, 9 });
+
+        matrix += matrix2 * 2;
+        REQUIRE(matrix == std::initializer_list<double>{ 7, 11, 15, 19 });
+
+        matrix -= matrix1 - matrix3;
+        REQUIRE(matrix == std::initializer_list<double>{ 7, 10, 13, 16 });
+    }
+
+    SECTION("Expression operands of a product are evaluated first")
+    {
+        const auto result = (matrix1 + matrix2) * matrix1;
+        REQUIRE(result == (matrix1 * matrix1 + matrix2 * matrix1));
+    }
+
+    SECTION("Size mismatch")
+    {
+        using scaled = decltype(matrix1 * 2.0);
+        STATIC_REQUIRE(addable<scaled, mtl::Matrix<int, 2, 2>>);
+        STATIC_REQUIRE_FALSE(addable<scaled, mtl::Matrix<double, 3, 3>>);
+        STATIC_REQUIRE_FALSE(assignable<
+                             mtl::Matrix<double, 3, 3>,
+                             decltype(matrix1 + matrix2)>);
+        STATIC_REQUIRE_FALSE(multipliable<
+                             decltype(matrix1 + matrix2),
+                             mtl::Matrix<double, 3, 3>>);
+
+        const mtl::DynamicMatrix<double> matrix(3, 3, 1.0);
+        mtl::Matrix<double, 2, 2> destination(0.0);
+
+        REQUIRE_THROWS_AS(matrix1 + matrix * 2.0, std::logic_error);
+        REQUIRE_THROWS_AS(destination = matrix + matrix, std::logic_error);
+        REQUIRE_THROWS_AS(destination += matrix * 2.0, std::logic_error);
+    }
+}
+
+TEST_CASE("Fixed-size specializations")
+{
+    SECTION("Product of inline matrices is a constant expression")
+    {
+        constexpr mtl::Matrix<int, 2, 3> lhs{ 1, 2, 3, 4, 5, 6 };
+        constexpr mtl::Matrix<int, 3, 2> rhs{ 1, 2, 3, 4, 5, 6 };
+        constexpr auto product = lhs * rhs;
+
+        STATIC_REQUIRE(product.at(0, 0) == 22);
+        STATIC_REQUIRE(product.at(1, 1) == 64);
+        REQUIRE(product == std::initializer_list<int>{ 22, 28, 49, 64 });
+    }
+
+    SECTION("4x4 product")
+    {
+        mtl::Matrix<double, 4, 4> matrix;
+        std::iota(matrix.data(), matrix.data() + 16, 1.0);
+
+        mtl::DynamicMatrix<double> dynamic(4, 4);
+        std::copy_n(matrix.data(), 16, dynamic.data());
+
+        REQUIRE(matrix * matrix == dynamic * dynamic);
+    }
+
+    SECTION("Closed-form determinant")
+    {
+        const mtl::Matrix<int, 3, 3> matrix{ 7, 2, 9, 4, 5, 3, 2, 6, 7 };
+        const mtl::DynamicMatrix<int> dynamic{ { 7, 2, 9 },
+                                               { 4, 5, 3 },
+                                               { 2, 6, 7 } };
+
+        REQUIRE(matrix.det() == 201);
+        REQUIRE(matrix.det() == dynamic.det());
+        REQUIRE(mtl::Matrix<double, 1, 1>{ 2.5 }.det() == 2.5);
+
+        const mtl::Matrix<int, 4, 4> four{ 3, 1, 4, 1, 5, 9, 2, 6,
+                                           5, 3, 5, 8, 9, 7, 9, 3 };
+        const mtl::DynamicMatrix<int> dynamic_four{ { 3, 1, 4, 1 },
+                                                    { 5, 9, 2, 6 },
+                                                    { 5, 3, 5, 8 },
+                                                    { 9, 7, 9, 3 } };
+        REQUIRE(four.det() == dynamic_four.det());
+        REQUIRE(four.det() == 98);
+        REQUIRE(four.transpose().det() == 98);
+    }
+}
+
 TEST_CASE("Multiplication - quadratic matrix")
 {
     const mtl::Matrix<int, 2, 2> matrix{ 1, 2, 3, 4 };
@@ -772,4 +1334,231 @@ TEST_CASE("Multiplication - quadratic matrix")
 
     REQUIRE(result.size() == matrix.size());
     REQUIRE(result == result_values);
-}
\ No newline at end of file
+}
+TEST_CASE("Multiplication - blocked kernel")
+{
+    constexpr std::size_t m = 130;
+    constexpr std::size_t k = 300;
+    constexpr std::size_t n = 37;
+
+    mtl::Matrix<double, m, k> lhs;
+    mtl::Matrix<int, k, n> rhs;
+    for (std::size_t i = 0; i < m * k; ++i) {
+        lhs.data()[i] = static_cast<double>(i % 7) - 2.5;
+    }
+    for (std::size_t i = 0; i < k * n; ++i) {
+        rhs.data()[i] = static_cast<int>(i % 5) - 1;
+    }
+
+    const auto result = lhs * rhs;
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            double expected = 0;
+            for (std::size_t p = 0; p < k; ++p) {
+                expected += lhs(i, p) * rhs(p, j);
+            }
+            if (result(i, j) != expected) { ++mismatches; }
+        }
+    }
+    REQUIRE(mismatches == 0);
+
+    SECTION("Multiplication assignment")
+    {
+        mtl::Matrix<double, m, k> square_lhs = lhs;
+        mtl::Matrix<double, k, k> identity(0.0);
+        for (std::size_t i = 0; i < k; ++i) { identity(i, i) = 1.0; }
+
+        square_lhs *= identity;
+        REQUIRE(square_lhs == lhs);
+    }
+
+    SECTION("Multiplication assignment of reallocated matrices")
+    {
+        // A reallocated matrix keeps its shape, so a product with more
+        // columns is rejected instead of overrunning its buffer.
+        mtl::Matrix<double, 5, 5> narrow;
+        narrow.realloc(2, 3);
+        mtl::Matrix<double, 5, 5> wide;
+        wide.realloc(3, 8);
+        REQUIRE_THROWS_AS(narrow *= wide, std::logic_error);
+        REQUIRE(narrow.row_size() == 2);
+        REQUIRE(narrow.col_size() == 3);
+
+        mtl::Matrix<double, 5, 5> square;
+        square.realloc(3, 3);
+        std::fill(square.begin(), square.end(), 0.0);
+        for (std::size_t i = 0; i < 3; ++i) { square(i, i) = 2.0; }
+        std::fill(narrow.begin(), narrow.end(), 1.0);
+        narrow *= square;
+        REQUIRE(narrow.col_size() == 3);
+        REQUIRE(std::all_of(narrow.begin(), narrow.end(), [](double value) {
+            return value == 2.0;
+        }));
+    }
+}
+
+TEST_CASE("Output parameters")
+{
+    const mtl::DynamicMatrix<double> lhs{ { 1, 2, 3 }, { 4, 5, 6 } };
+    const mtl::DynamicMatrix<double> rhs{ { 1, 0 }, { 0, 1 }, { 1, 1 } };
+    const auto product = lhs * rhs;
+
+    SECTION("Products")
+    {
+        mtl::DynamicMatrix<double> out;
+        mtl::multiply_into(out, lhs, rhs);
+        REQUIRE(out == product);
+
+        mtl::gemm(2.0, lhs, rhs, -1.0, out);
+        REQUIRE(out == product);
+        mtl::gemm(
+            mtl::execution::par,
+            1.0,
+            rhs.transpose(),
+            mtl::transposed(lhs),
+            1.0,
+            out.transpose_inplace());
+        REQUIRE(out == 2.0 * product.transpose());
+
+        mtl::Matrix<double, 2, 2> fixed;
+        mtl::multiply_into(fixed, lhs, rhs);
+        REQUIRE(fixed == product);
+
+        mtl::Matrix<int, 2, 2> square{ 1, 2, 3, 4 };
+        mtl::Matrix<int, 2, 2> inline_out;
+        mtl::multiply_into(inline_out, square, square);
+        REQUIRE(inline_out == mtl::Matrix<int, 2, 2>{ 7, 10, 15, 22 });
+
+        REQUIRE_THROWS_AS(
+            mtl::multiply_into(square, square, square),
+            std::logic_error);
+        mtl::DynamicMatrix<double> mismatched(3, 3);
+        REQUIRE_THROWS_AS(
+            mtl::gemm(1.0, lhs, rhs, 1.0, mismatched),
+            std::logic_error);
+        mtl::Matrix<double, 3, 3> wrong_size;
+        REQUIRE_THROWS_AS(
+            mtl::multiply_into(wrong_size, lhs, rhs),
+            std::logic_error);
+    }
+
+    SECTION("Large products reuse the destination")
+    {
+        mtl::DynamicMatrix<float> a(70, 90, 0.5F);
+        mtl::DynamicMatrix<float> b(90, 60, 2.0F);
+        mtl::DynamicMatrix<float> out(70, 60);
+        const auto* buffer = out.data();
+
+        mtl::multiply_into(mtl::execution::par, out, a, b);
+        mtl::gemm(1.0F, a, b, 1.0F, out);
+        REQUIRE(out.data() == buffer);
+        REQUIRE(out == 2.0F * (a * b));
+    }
+
+    SECTION("Transposes")
+    {
+        mtl::DynamicMatrix<double> out(3, 2);
+        mtl::transpose_into(out, lhs);
+        REQUIRE(out == lhs.transpose());
+
+        mtl::Matrix<int, 2, 2> square{ 1, 2, 3, 4 };
+        mtl::transpose_into(square, square);
+        REQUIRE(square == mtl::Matrix<int, 2, 2>{ 1, 3, 2, 4 });
+
+        auto wide = lhs;
+        REQUIRE_THROWS_AS(mtl::transpose_into(wide, wide), std::logic_error);
+    }
+
+    SECTION("Element-wise")
+    {
+        mtl::DynamicMatrix<double> out;
+        mtl::add_into(out, lhs, lhs);
+        REQUIRE(out == 2.0 * lhs);
+        mtl::subtract_into(out, lhs, out);
+        REQUIRE(out == -1.0 * lhs);
+        mtl::add_into(out, lhs, out);
+        REQUIRE(out == mtl::DynamicMatrix<double>(2, 3));
+
+        mtl::Matrix<int, 2, 3> mixed;
+        mtl::add_into(mixed, lhs, lhs * 3.0);
+        REQUIRE(mixed == 4.0 * lhs);
+        mtl::subtract_into(mtl::execution::par, out, lhs, mixed);
+        REQUIRE(out == -3.0 * lhs);
+
+        REQUIRE_THROWS_AS(
+            mtl::add_into(out, lhs, product),
+            std::logic_error);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "Vectorized element-wise kernels",
+    "",
+    float,
+    double,
+    std::int32_t,
+    std::int64_t)
+{
+    using mtl::detail::simd::isa;
+
+    constexpr std::size_t count = 1037;
+    std::vector<TestType> lhs(count);
+    std::vector<TestType> rhs(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        lhs[i] = static_cast<TestType>(i % 13);
+        rhs[i] = static_cast<TestType>(i % 7);
+    }
+
+    const auto levels = { isa::scalar, isa::avx2, isa::avx512, isa::neon };
+    for (const auto level : levels) {
+        if (not mtl::detail::simd::supports(level)) { continue; }
+
+        auto result = lhs;
+        mtl::detail::simd::binary<mtl::detail::simd::op::add>(
+            level,
+            result.data(),
+            rhs.data(),
+            count);
+        mtl::detail::simd::scale(level, result.data(), count, TestType{ 3 });
+        mtl::detail::simd::binary<mtl::detail::simd::op::sub>(
+            level,
+            result.data(),
+            lhs.data(),
+            count);
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto expected =
+                static_cast<TestType>((lhs[i] + rhs[i]) * 3 - lhs[i]);
+            if (result[i] != expected) { ++mismatches; }
+        }
+        REQUIRE(mismatches == 0);
+
+        REQUIRE(mtl::detail::simd::equal(level, lhs.data(), lhs.data(), count));
+        auto changed = lhs;
+        changed.back() = TestType{ 100 };
+        REQUIRE_FALSE(
+            mtl::detail::simd::equal(level, lhs.data(), changed.data(), count));
+
+        mtl::detail::simd::fill(level, changed.data(), count, TestType{ 5 });
+        REQUIRE(std::all_of(changed.begin(), changed.end(), [](auto elem) {
+            return elem == TestType{ 5 };
+        }));
+    }
+
+    SECTION("Matrix operations")
+    {
+        mtl::Matrix<TestType, 9, 11> matrix(TestType{ 2 });
+        const mtl::Matrix<TestType, 9, 11> other(TestType{ 1 });
+
+        matrix += other;
+        matrix *= TestType{ 2 };
+        matrix -= other;
+        REQUIRE(matrix == mtl::Matrix<TestType, 9, 11>(TestType{ 5 }));
+
+        matrix.clear();
+        REQUIRE(matrix == mtl::Matrix<TestType, 9, 11>(TestType{ 0 }));
+    }
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <matrix.hpp>
+#include <thread_pool.hpp>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "helpers.hpp"
+
+TEST_CASE("Thread pool")
+{
+    mtl::thread_pool pool{ 4 };
+    REQUIRE(pool.size() == 4);
+
+    SECTION("parallel_for covers every index exactly once")
+    {
+        std::vector<std::atomic<int>> hits(100000);
+        pool.parallel_for(hits.size(), 1000, [&](std::size_t b, std::size_t e) {
+            for (auto i = b; i < e; ++i) { ++hits[i]; }
+        });
+
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](const auto& hit) {
+            return hit == 1;
+        }));
+    }
+
+    SECTION("Nested parallel_for")
+    {
+        std::atomic<std::size_t> total{ 0 };
+        pool.parallel_for(16, 1, [&](std::size_t b, std::size_t e) {
+            for (auto i = b; i < e; ++i) {
+                pool.parallel_for(64, 1, [&](std::size_t ib, std::size_t ie) {
+                    total += ie - ib;
+                });
+            }
+        });
+
+        REQUIRE(total == 16 * 64);
+    }
+
+    SECTION("Exceptions are rethrown to the caller")
+    {
+        REQUIRE_THROWS_AS(
+            pool.parallel_for(
+                64,
+                1,
+                [](std::size_t b, std::size_t) {
+                    if (b != 0) { throw std::runtime_error{ "chunk" }; }
+                }),
+            std::runtime_error);
+    }
+
+    SECTION("Pinned workers")
+    {
+        mtl::thread_pool pinned{ 2, { 0 } };
+        std::atomic<int> calls{ 0 };
+        pinned.parallel_for(8, 1, [&](std::size_t, std::size_t) { ++calls; });
+        REQUIRE(calls > 0);
+    }
+}
+
+TEST_CASE("Parallel execution policies")
+{
+    mtl::thread_pool pool{ 3 };
+    const auto policy = mtl::execution::on(pool);
+
+    SECTION("multiply")
+    {
+        const auto lhs = test::seeded_matrix<double, 5, 5>(300, 170, 4);
+        const auto rhs = test::seeded_matrix<double, 5, 5>(170, 210, 5);
+
+        const auto expected = mtl::multiply(lhs, rhs);
+        REQUIRE(mtl::multiply(policy, lhs, rhs) == expected);
+        REQUIRE(mtl::multiply(mtl::execution::par, lhs, rhs) == expected);
+
+        const auto wide = test::seeded_matrix<double, 5, 5>(300, 600, 2);
+        REQUIRE(
+            mtl::multiply(policy, lhs.transpose(), wide)
+            == mtl::multiply(lhs.transpose(), wide));
+    }
+
+    SECTION("det")
+    {
+        auto matrix = test::seeded_matrix<double, 5, 5>(200, 200, 5);
+        for (std::size_t i = 0; i < 200; ++i) { matrix(i, i) += 40; }
+
+        REQUIRE(matrix.det(policy) == matrix.det());
+        REQUIRE(matrix.det(mtl::execution::seq) == matrix.det());
+    }
+
+    SECTION("assign")
+    {
+        const auto lhs = test::seeded_matrix<double, 5, 5>(400, 300, 1);
+        const auto rhs = test::seeded_matrix<double, 5, 5>(400, 300, 2);
+
+        auto result = test::seeded_matrix<double, 5, 5>(400, 300, 0);
+        mtl::assign(policy, result, lhs + rhs * 2.0);
+
+        const mtl::Matrix<double, 5, 5> expected = lhs + rhs * 2.0;
+        REQUIRE(result == expected);
+
+        mtl::Matrix<double, 5, 5> small(1.0);
+        REQUIRE_THROWS_AS(
+            mtl::assign(policy, small, lhs - rhs),
+            std::logic_error);
+    }
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector.hpp>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Vectors")
+{
+    mtl::Vector<int, 3> fixed{ 1, 2, 3 };
+    REQUIRE(fixed.size() == 3);
+    REQUIRE(fixed[2] == 3);
+    REQUIRE_THROWS_AS(fixed.at(3), std::out_of_range);
+    REQUIRE_THROWS_AS((mtl::Vector<int, 3>{ 1, 2 }), std::logic_error);
+    REQUIRE(mtl::Vector<int, 3>(7) != fixed);
+    REQUIRE(mtl::Vector<int, 2>(7)[1] == 7);
+
+    mtl::DynamicVector<double> runtime(4, 1.5);
+    REQUIRE(runtime.size() == 4);
+    runtime.resize(6);
+    REQUIRE(runtime[5] == 0.0);
+
+    const std::span<const int> view = fixed;
+    REQUIRE(view.size() == 3);
+    REQUIRE(mtl::DynamicVector<int>{ view } == fixed);
+}
+
+TEST_CASE("Matrix-vector products")
+{
+    const mtl::Matrix<int, 2, 3> small{ 1, 2, 3, 4, 5, 6 };
+    const mtl::Vector<int, 3> x{ 1, 0, -1 };
+    const mtl::Vector<int, 2> expected{ -2, -2 };
+    REQUIRE((small * x) == expected);
+    REQUIRE(mtl::multiply(mtl::transposed(small), expected)
+            == mtl::Vector<int, 3>{ -10, -14, -18 });
+    REQUIRE_THROWS_AS(
+        mtl::multiply(mtl::DynamicMatrix<int>(2, 2), x),
+        std::logic_error);
+
+    mtl::DynamicMatrix<double> large(300, 257);
+    mtl::DynamicVector<double> input(257);
+    for (std::size_t j = 0; j < 257; ++j) {
+        input[j] = static_cast<double>(j % 5);
+        for (std::size_t i = 0; i < 300; ++i) {
+            large(i, j) = static_cast<double>((i + j) % 7) - 3.0;
+        }
+    }
+
+    mtl::DynamicVector<double> reference(300);
+    for (std::size_t i = 0; i < 300; ++i) {
+        for (std::size_t j = 0; j < 257; ++j) {
+            reference[i] += large(i, j) * input[j];
+        }
+    }
+
+    SECTION("Policies")
+    {
+        REQUIRE(mtl::multiply(large, input) == reference);
+        REQUIRE(mtl::multiply(mtl::execution::par, large, input) == reference);
+
+        const auto transposed = large.transpose();
+        REQUIRE(mtl::multiply(mtl::transposed(transposed), input) == reference);
+    }
+
+    SECTION("Fused update")
+    {
+        std::vector<double> output(
+            300,
+            std::numeric_limits<double>::quiet_NaN());
+        mtl::gemv(2.0, large, input, 0.0, output);
+        REQUIRE(output[299] == 2.0 * reference[299]);
+
+        mtl::gemv(mtl::execution::par, 1.0, large, input, -2.0, output);
+        for (std::size_t i = 0; i < 300; ++i) {
+            REQUIRE(output[i] == -3.0 * reference[i]);
+        }
+
+        REQUIRE_THROWS_AS(
+            mtl::gemv(1.0, large, input, 0.0, std::span{ output }.first(299)),
+            std::logic_error);
+    }
+
+    SECTION("Column result")
+    {
+        auto column = large;
+        column *= std::vector<double>(input.begin(), input.end());
+        REQUIRE(column.size() == std::pair<std::size_t, std::size_t>{ 300, 1 });
+        REQUIRE(column(299, 0) == reference[299]);
+
+        mtl::Matrix<int, 2, 3> fixed = small;
+        REQUIRE_THROWS_AS(
+            (fixed *= std::vector<int>{ 1, 0, -1 }),
+            std::logic_error);
+    }
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include <io.hpp>
+#include <vector.hpp>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "helpers.hpp"
+
+TEST_CASE("Blocks, rows and columns")
+{
+    const auto source = test::iota_matrix(4, 5);
+
+    const auto middle = mtl::block(source, 1, 2, 2, 3);
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(middle), const mtl::MatrixView<int>>);
+    REQUIRE(middle.size() == std::pair<std::size_t, std::size_t>{ 2, 3 });
+    REQUIRE(middle.data() == source.data() + 7);
+    REQUIRE(middle(1, 2) == 14);
+    REQUIRE_FALSE(middle.is_contiguous());
+    REQUIRE_THROWS_AS(middle.span(), std::logic_error);
+    REQUIRE(
+        middle.to_matrix() == mtl::Matrix<int, 2, 3>{ 7, 8, 9, 12, 13, 14 });
+    REQUIRE(middle.block(1, 1, 1, 2)(0, 1) == 14);
+
+    REQUIRE(
+        mtl::row(source, 3) == mtl::Matrix<int, 1, 5>{ 15, 16, 17, 18, 19 });
+    REQUIRE(mtl::col(source, 1) == mtl::Matrix<int, 4, 1>{ 1, 6, 11, 16 });
+    REQUIRE(mtl::row(source, 3).is_contiguous());
+    REQUIRE(mtl::col(middle, 0)(1, 0) == 12);
+
+    REQUIRE_THROWS_AS(mtl::block(source, 3, 0, 2, 1), std::out_of_range);
+    REQUIRE_THROWS_AS(mtl::col(source, 5), std::out_of_range);
+    REQUIRE_NOTHROW(mtl::block(source, 4, 5, 0, 0));
+}
+
+TEST_CASE("Views in expressions and products")
+{
+    const auto source = test::iota_matrix(4, 5);
+    const auto left = mtl::block(source, 0, 0, 2, 2);
+    const auto right = mtl::block(source, 2, 3, 2, 2);
+
+    const mtl::Matrix<int, 2, 2> sum = left + right;
+    REQUIRE(sum == mtl::Matrix<int, 2, 2>{ 13, 15, 23, 25 });
+    REQUIRE((left - right * 2) == mtl::Matrix<int, 2, 2>{ -26, -27, -31, -32 });
+
+    const auto product = left * mtl::transposed(right);
+    REQUIRE(product == mtl::Matrix<int, 2, 2>{ 14, 19, 149, 204 });
+    REQUIRE(mtl::transposed(left)(0, 1) == 5);
+    REQUIRE(mtl::transposed(left).to_matrix() == left.to_matrix().transpose());
+
+    mtl::DynamicVector<int> x{ 1, 1 };
+    REQUIRE((left * x) == mtl::DynamicVector<int>{ 1, 11 });
+
+    std::stringstream stream;
+    mtl::save(stream, right);
+    REQUIRE(mtl::load<int>(stream) == right.to_matrix());
+}
+
+TEST_CASE("Writing through spans")
+{
+    auto target = test::iota_matrix(4, 4);
+
+    SECTION("Assignment writes elements")
+    {
+        auto corner = mtl::block(target, 2, 2, 2, 2);
+        STATIC_REQUIRE(std::is_same_v<decltype(corner), mtl::MatrixSpan<int>>);
+        corner = mtl::Matrix<int, 2, 2>{ -1, -2, -3, -4 };
+        REQUIRE(target(3, 3) == -4);
+        REQUIRE(corner.data() == target.data() + 10);
+
+        // Copy-assigning one span to another copies the elements.
+        auto first = mtl::block(target, 0, 0, 2, 2);
+        first = corner;
+        REQUIRE(target(1, 0) == -3);
+        REQUIRE(first.data() == target.data());
+
+        const auto other = test::iota_matrix(4, 4);
+        mtl::col(target, 1) = mtl::transposed(mtl::row(other, 2));
+        REQUIRE(mtl::col(target, 1) == mtl::Matrix<int, 4, 1>{ 8, 9, 10, 11 });
+
+        REQUIRE_THROWS_AS(
+            (corner = mtl::Matrix<int, 1, 2>{ 0, 0 }),
+            std::logic_error);
+    }
+
+    SECTION("Compound assignment")
+    {
+        auto top = mtl::block(target, 0, 0, 2, 4);
+        top += mtl::block(target, 2, 0, 2, 4);
+        top -= mtl::block(target, 2, 0, 2, 4) * 2;
+        top *= -1;
+        REQUIRE(target(1, 3) == 8);
+        mtl::row(target, 3).fill(0);
+        REQUIRE(target(3, 0) == 0);
+        REQUIRE(target(2, 0) == 8);
+
+        mtl::DynamicMatrix<int> other(4, 4);
+        mtl::assign(
+            mtl::execution::par,
+            mtl::transposed(mtl::MatrixSpan{ other }),
+            target);
+        REQUIRE(other == target.transpose());
+    }
+
+    SECTION("Products into blocks")
+    {
+        mtl::DynamicMatrix<double> a(60, 60, 1.0);
+        mtl::DynamicMatrix<double> b(60, 60, 2.0);
+        mtl::DynamicMatrix<double> c(120, 120, 0.5);
+
+        // C21 = A * B, C12' = A * B and C22 += 2 * A * B, leaving C11 alone.
+        mtl::multiply_into(mtl::block(c, 60, 0, 60, 60), a, b);
+        mtl::multiply_into(
+            mtl::execution::par,
+            mtl::transposed(mtl::block(c, 0, 60, 60, 60)),
+            a,
+            b);
+        mtl::gemm(2.0, a, b, 1.0, mtl::block(c, 60, 60, 60, 60));
+        REQUIRE(c(0, 0) == 0.5);
+        REQUIRE(c(119, 0) == 120.0);
+        REQUIRE(c(0, 119) == 120.0);
+        REQUIRE(c(119, 119) == 240.5);
+
+        // Recursive halving works on the parent's elements.
+        mtl::DynamicMatrix<double> d(120, 120);
+        auto half = mtl::block(d, 0, 0, 60, 120);
+        mtl::multiply_into(
+            half,
+            mtl::block(c, 0, 0, 60, 60),
+            mtl::block(c, 0, 0, 60, 120));
+        REQUIRE(d(0, 0) == 60 * 0.25);
+        REQUIRE(d(60, 0) == 0.0);
+
+        REQUIRE_THROWS_AS(
+            mtl::multiply_into(mtl::block(c, 0, 0, 60, 60), c, c),
+            std::logic_error);
+        REQUIRE_THROWS_AS(
+            mtl::multiply_into(
+                mtl::block(c, 0, 0, 60, 60),
+                mtl::block(c, 0, 0, 60, 60),
+                a),
+            std::logic_error);
+    }
+}